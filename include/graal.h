@@ -7,87 +7,4089 @@
 #ifndef GRAAL_H
 #define GRAAL_H
 
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <cwchar>
+#include <exception>
+#include <forward_list>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <list>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/*
+ * Seleção do conjunto de instruções SIMD usado pelos kernels internos.
+ * O nível é decidido em tempo de compilação a partir das flags do compilador
+ * (ex.: -msse4.1, -mavx2, -march=native). Defina GRAAL_NO_SIMD para forçar
+ * apenas os laços escalares.
+ *
+ *   0 -> sem SIMD
+ *   1 -> SSE2 (base de todo x86-64), com blend SSE4.1 quando disponível
+ *   2 -> AVX2
+ *   3 -> AVX-512 (F, BW, DQ e VL)
+ */
+#if !defined(GRAAL_NO_SIMD) && (defined(__x86_64__) || defined(_M_X64))
+// Os intrínsecos AVX-512 do GCC 12 geram falsos -Wmaybe-uninitialized (GCC PR 105593).
+# if defined(__GNUC__) && !defined(__clang__)
+#  pragma GCC diagnostic push
+#  pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+# endif
+# include <immintrin.h>
+# if defined(__GNUC__) && !defined(__clang__)
+#  pragma GCC diagnostic pop
+# endif
+# if defined(__AVX512F__) && defined(__AVX512BW__) && defined(__AVX512DQ__) && defined(__AVX512VL__)
+#  define GRAAL_SIMD_LEVEL 3
+# elif defined(__AVX2__)
+#  define GRAAL_SIMD_LEVEL 2
+# else
+#  define GRAAL_SIMD_LEVEL 1
+# endif
+#else
+# define GRAAL_SIMD_LEVEL 0
+#endif
+
 using std::pair;
 
 namespace graal {
 
+namespace detail {
+
+/// Indica se `It` percorre memória contígua (ponteiros e iteradores de `std::vector`).
+template <class It, class = void> struct is_contiguous_iterator : std::is_pointer<It> {};
+
+template <class It> using vector_of_t = std::vector<typename std::iterator_traits<It>::value_type>;
+
+template <class It>
+struct is_contiguous_iterator<
+  It,
+  std::enable_if_t<!std::is_pointer<It>::value
+                   && std::is_object<typename std::iterator_traits<It>::value_type>::value
+                   && !std::is_same<typename std::iterator_traits<It>::value_type, bool>::value>>
+  : std::bool_constant<std::is_same<It, typename vector_of_t<It>::iterator>::value
+                       || std::is_same<It, typename vector_of_t<It>::const_iterator>::value> {};
+
+/// Ponteiro para o elemento apontado por um iterador contíguo (que não pode ser o fim do range).
+template <class It> auto to_pointer(It it) { return std::addressof(*it); }
+
+/// Tipo usado pelos kernels SIMD para representar `T`, ou `void` se `T` não tem kernel.
+template <class T, bool = std::is_arithmetic<T>::value> struct simd_key {
+  using type = void;
+};
+template <class T> struct simd_key<T, true> {
+  using type = std::conditional_t<
+    std::is_same<T, float>::value || std::is_same<T, double>::value,
+    T,
+    std::conditional_t<std::is_integral<T>::value && std::is_signed<T>::value && sizeof(T) == 4,
+                       std::int32_t,
+                       std::conditional_t<std::is_integral<T>::value && std::is_signed<T>::value
+                                            && sizeof(T) == 8,
+                                          std::int64_t,
+                                          void>>>;
+};
+template <class T> using simd_key_t = typename simd_key<T>::type;
+
+/**
+ * @brief Classifica um comparador: +1 para `std::less`, -1 para `std::greater`, 0 para os demais.
+ *
+ * Só os comparadores da biblioteca padrão têm semântica conhecida, então só eles
+ * podem ser trocados por instruções de comparação vetoriais.
+ */
+template <class Compare, class T> struct compare_direction : std::integral_constant<int, 0> {};
+template <class T> struct compare_direction<std::less<>, T> : std::integral_constant<int, 1> {};
+template <class T> struct compare_direction<std::less<T>, T> : std::integral_constant<int, 1> {};
+template <class T> struct compare_direction<std::greater<>, T> : std::integral_constant<int, -1> {};
+template <class T>
+struct compare_direction<std::greater<T>, T> : std::integral_constant<int, -1> {};
+
+namespace simd {
+
+/**
+ * @brief Operações vetoriais para o tipo `T` no nível SIMD ativo.
+ *
+ * Cada especialização expõe o mesmo conjunto de operações (`load`, `lt`, `le`, `select`, ...)
+ * sobre um registrador de valores `reg`, uma máscara `mask` e um registrador de índices
+ * `ireg`, de modo que os kernels sejam escritos uma vez só para todos os níveis.
+ */
+template <class T> struct ops {
+  static constexpr bool enabled = false;
+};
+
+#if GRAAL_SIMD_LEVEL == 1
+/// Seleciona `a` onde a máscara está ligada e `b` nas demais lanes.
+inline __m128i blend(__m128i m, __m128i a, __m128i b)
+{
+# if defined(__SSE4_1__)
+  return _mm_blendv_epi8(b, a, m);
+# else
+  return _mm_or_si128(_mm_and_si128(m, a), _mm_andnot_si128(m, b));
+# endif
+}
+
+template <> struct ops<std::int32_t> {
+  static constexpr bool enabled = true;
+  static constexpr std::size_t lanes = 4;
+  using reg = __m128i;
+  using mask = __m128i;
+  using ireg = __m128i;
+  using index_type = std::int32_t;
+  static reg load(const void* p) { return _mm_loadu_si128(static_cast<const __m128i*>(p)); }
+  static reg set1(std::int32_t x) { return _mm_set1_epi32(x); }
+  static unsigned bits(mask m)
+  {
+    return static_cast<unsigned>(_mm_movemask_ps(_mm_castsi128_ps(m)));
+  }
+  static void store(void* p, reg v) { _mm_storeu_si128(static_cast<__m128i*>(p), v); }
+  static mask lt(reg a, reg b) { return _mm_cmplt_epi32(a, b); }
+  static mask le(reg a, reg b) { return _mm_xor_si128(_mm_cmpgt_epi32(a, b), _mm_set1_epi32(-1)); }
+  static reg select(mask m, reg a, reg b) { return blend(m, a, b); }
+  static ireg iselect(mask m, ireg a, ireg b) { return blend(m, a, b); }
+  static ireg iota() { return _mm_setr_epi32(0, 1, 2, 3); }
+  static ireg iset1(index_type i) { return _mm_set1_epi32(i); }
+  static ireg iadd(ireg a, ireg b) { return _mm_add_epi32(a, b); }
+  static void istore(index_type* p, ireg v) { store(p, v); }
+};
+
+template <> struct ops<float> {
+  static constexpr bool enabled = true;
+  static constexpr std::size_t lanes = 4;
+  using reg = __m128;
+  using mask = __m128;
+  using ireg = __m128i;
+  using index_type = std::int32_t;
+  static reg load(const void* p) { return _mm_loadu_ps(static_cast<const float*>(p)); }
+  static reg set1(float x) { return _mm_set1_ps(x); }
+  static void store(void* p, reg v) { _mm_storeu_ps(static_cast<float*>(p), v); }
+  static mask lt(reg a, reg b) { return _mm_cmplt_ps(a, b); }
+  static mask le(reg a, reg b) { return _mm_cmple_ps(a, b); }
+  static reg select(mask m, reg a, reg b)
+  {
+    return _mm_castsi128_ps(blend(_mm_castps_si128(m), _mm_castps_si128(a), _mm_castps_si128(b)));
+  }
+  static ireg iselect(mask m, ireg a, ireg b) { return blend(_mm_castps_si128(m), a, b); }
+  static ireg iota() { return _mm_setr_epi32(0, 1, 2, 3); }
+  static ireg iset1(index_type i) { return _mm_set1_epi32(i); }
+  static ireg iadd(ireg a, ireg b) { return _mm_add_epi32(a, b); }
+  static void istore(index_type* p, ireg v) { _mm_storeu_si128(reinterpret_cast<__m128i*>(p), v); }
+  static mask isnan(reg a) { return _mm_cmpunord_ps(a, a); }
+  static reg nan() { return _mm_set1_ps(std::numeric_limits<float>::quiet_NaN()); }
+  static mask mor(mask a, mask b) { return _mm_or_ps(a, b); }
+  static mask mandnot(mask a, mask b) { return _mm_andnot_ps(b, a); }
+  static unsigned bits(mask m) { return static_cast<unsigned>(_mm_movemask_ps(m)); }
+};
+
+template <> struct ops<double> {
+  static constexpr bool enabled = true;
+  static constexpr std::size_t lanes = 2;
+  using reg = __m128d;
+  using mask = __m128d;
+  using ireg = __m128i;
+  using index_type = std::int64_t;
+  static reg load(const void* p) { return _mm_loadu_pd(static_cast<const double*>(p)); }
+  static reg set1(double x) { return _mm_set1_pd(x); }
+  static void store(void* p, reg v) { _mm_storeu_pd(static_cast<double*>(p), v); }
+  static mask lt(reg a, reg b) { return _mm_cmplt_pd(a, b); }
+  static mask le(reg a, reg b) { return _mm_cmple_pd(a, b); }
+  static reg select(mask m, reg a, reg b)
+  {
+    return _mm_castsi128_pd(blend(_mm_castpd_si128(m), _mm_castpd_si128(a), _mm_castpd_si128(b)));
+  }
+  static ireg iselect(mask m, ireg a, ireg b) { return blend(_mm_castpd_si128(m), a, b); }
+  static ireg iota() { return _mm_set_epi64x(1, 0); }
+  static ireg iset1(index_type i) { return _mm_set1_epi64x(i); }
+  static ireg iadd(ireg a, ireg b) { return _mm_add_epi64(a, b); }
+  static void istore(index_type* p, ireg v) { _mm_storeu_si128(reinterpret_cast<__m128i*>(p), v); }
+  static mask isnan(reg a) { return _mm_cmpunord_pd(a, a); }
+  static reg nan() { return _mm_set1_pd(std::numeric_limits<double>::quiet_NaN()); }
+  static mask mor(mask a, mask b) { return _mm_or_pd(a, b); }
+  static mask mandnot(mask a, mask b) { return _mm_andnot_pd(b, a); }
+  static unsigned bits(mask m) { return static_cast<unsigned>(_mm_movemask_pd(m)); }
+};
+#endif
+
+#if GRAAL_SIMD_LEVEL == 2
+template <> struct ops<std::int32_t> {
+  static constexpr bool enabled = true;
+  static constexpr std::size_t lanes = 8;
+  using reg = __m256i;
+  using mask = __m256i;
+  using ireg = __m256i;
+  using index_type = std::int32_t;
+  static reg load(const void* p) { return _mm256_loadu_si256(static_cast<const __m256i*>(p)); }
+  static reg set1(std::int32_t x) { return _mm256_set1_epi32(x); }
+  static unsigned bits(mask m)
+  {
+    return static_cast<unsigned>(_mm256_movemask_ps(_mm256_castsi256_ps(m)));
+  }
+  static void store(void* p, reg v) { _mm256_storeu_si256(static_cast<__m256i*>(p), v); }
+  static mask lt(reg a, reg b) { return _mm256_cmpgt_epi32(b, a); }
+  static mask le(reg a, reg b)
+  {
+    return _mm256_xor_si256(_mm256_cmpgt_epi32(a, b), _mm256_set1_epi32(-1));
+  }
+  static reg select(mask m, reg a, reg b) { return _mm256_blendv_epi8(b, a, m); }
+  static ireg iselect(mask m, ireg a, ireg b) { return _mm256_blendv_epi8(b, a, m); }
+  static ireg iota() { return _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7); }
+  static ireg iset1(index_type i) { return _mm256_set1_epi32(i); }
+  static ireg iadd(ireg a, ireg b) { return _mm256_add_epi32(a, b); }
+  static void istore(index_type* p, ireg v) { store(p, v); }
+};
+
+template <> struct ops<std::int64_t> {
+  static constexpr bool enabled = true;
+  static constexpr std::size_t lanes = 4;
+  using reg = __m256i;
+  using mask = __m256i;
+  using ireg = __m256i;
+  using index_type = std::int64_t;
+  static reg load(const void* p) { return _mm256_loadu_si256(static_cast<const __m256i*>(p)); }
+  static reg set1(std::int64_t x) { return _mm256_set1_epi64x(x); }
+  static unsigned bits(mask m)
+  {
+    return static_cast<unsigned>(_mm256_movemask_pd(_mm256_castsi256_pd(m)));
+  }
+  static void store(void* p, reg v) { _mm256_storeu_si256(static_cast<__m256i*>(p), v); }
+  static mask lt(reg a, reg b) { return _mm256_cmpgt_epi64(b, a); }
+  static mask le(reg a, reg b)
+  {
+    return _mm256_xor_si256(_mm256_cmpgt_epi64(a, b), _mm256_set1_epi64x(-1));
+  }
+  static reg select(mask m, reg a, reg b) { return _mm256_blendv_epi8(b, a, m); }
+  static ireg iselect(mask m, ireg a, ireg b) { return _mm256_blendv_epi8(b, a, m); }
+  static ireg iota() { return _mm256_setr_epi64x(0, 1, 2, 3); }
+  static ireg iset1(index_type i) { return _mm256_set1_epi64x(i); }
+  static ireg iadd(ireg a, ireg b) { return _mm256_add_epi64(a, b); }
+  static void istore(index_type* p, ireg v) { store(p, v); }
+};
+
+template <> struct ops<float> {
+  static constexpr bool enabled = true;
+  static constexpr std::size_t lanes = 8;
+  using reg = __m256;
+  using mask = __m256;
+  using ireg = __m256i;
+  using index_type = std::int32_t;
+  static reg load(const void* p) { return _mm256_loadu_ps(static_cast<const float*>(p)); }
+  static reg set1(float x) { return _mm256_set1_ps(x); }
+  static void store(void* p, reg v) { _mm256_storeu_ps(static_cast<float*>(p), v); }
+  static mask lt(reg a, reg b) { return _mm256_cmp_ps(a, b, _CMP_LT_OQ); }
+  static mask le(reg a, reg b) { return _mm256_cmp_ps(a, b, _CMP_LE_OQ); }
+  static reg select(mask m, reg a, reg b) { return _mm256_blendv_ps(b, a, m); }
+  static ireg iselect(mask m, ireg a, ireg b)
+  {
+    return _mm256_castps_si256(
+      _mm256_blendv_ps(_mm256_castsi256_ps(b), _mm256_castsi256_ps(a), m));
+  }
+  static ireg iota() { return _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7); }
+  static ireg iset1(index_type i) { return _mm256_set1_epi32(i); }
+  static ireg iadd(ireg a, ireg b) { return _mm256_add_epi32(a, b); }
+  static void istore(index_type* p, ireg v)
+  {
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(p), v);
+  }
+  static mask isnan(reg a) { return _mm256_cmp_ps(a, a, _CMP_UNORD_Q); }
+  static reg nan() { return _mm256_set1_ps(std::numeric_limits<float>::quiet_NaN()); }
+  static mask mor(mask a, mask b) { return _mm256_or_ps(a, b); }
+  static mask mandnot(mask a, mask b) { return _mm256_andnot_ps(b, a); }
+  static unsigned bits(mask m) { return static_cast<unsigned>(_mm256_movemask_ps(m)); }
+};
+
+template <> struct ops<double> {
+  static constexpr bool enabled = true;
+  static constexpr std::size_t lanes = 4;
+  using reg = __m256d;
+  using mask = __m256d;
+  using ireg = __m256i;
+  using index_type = std::int64_t;
+  static reg load(const void* p) { return _mm256_loadu_pd(static_cast<const double*>(p)); }
+  static reg set1(double x) { return _mm256_set1_pd(x); }
+  static void store(void* p, reg v) { _mm256_storeu_pd(static_cast<double*>(p), v); }
+  static mask lt(reg a, reg b) { return _mm256_cmp_pd(a, b, _CMP_LT_OQ); }
+  static mask le(reg a, reg b) { return _mm256_cmp_pd(a, b, _CMP_LE_OQ); }
+  static reg select(mask m, reg a, reg b) { return _mm256_blendv_pd(b, a, m); }
+  static ireg iselect(mask m, ireg a, ireg b)
+  {
+    return _mm256_castpd_si256(
+      _mm256_blendv_pd(_mm256_castsi256_pd(b), _mm256_castsi256_pd(a), m));
+  }
+  static ireg iota() { return _mm256_setr_epi64x(0, 1, 2, 3); }
+  static ireg iset1(index_type i) { return _mm256_set1_epi64x(i); }
+  static ireg iadd(ireg a, ireg b) { return _mm256_add_epi64(a, b); }
+  static void istore(index_type* p, ireg v)
+  {
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(p), v);
+  }
+  static mask isnan(reg a) { return _mm256_cmp_pd(a, a, _CMP_UNORD_Q); }
+  static reg nan() { return _mm256_set1_pd(std::numeric_limits<double>::quiet_NaN()); }
+  static mask mor(mask a, mask b) { return _mm256_or_pd(a, b); }
+  static mask mandnot(mask a, mask b) { return _mm256_andnot_pd(b, a); }
+  static unsigned bits(mask m) { return static_cast<unsigned>(_mm256_movemask_pd(m)); }
+};
+#endif
+
+#if GRAAL_SIMD_LEVEL == 3
+template <> struct ops<std::int32_t> {
+  static constexpr bool enabled = true;
+  static constexpr std::size_t lanes = 16;
+  using reg = __m512i;
+  using mask = __mmask16;
+  using ireg = __m512i;
+  using index_type = std::int32_t;
+  static reg load(const void* p) { return _mm512_loadu_si512(p); }
+  static reg set1(std::int32_t x) { return _mm512_set1_epi32(x); }
+  static unsigned bits(mask m) { return m; }
+  static void store(void* p, reg v) { _mm512_storeu_si512(p, v); }
+  static mask lt(reg a, reg b) { return _mm512_cmplt_epi32_mask(a, b); }
+  static mask le(reg a, reg b) { return _mm512_cmple_epi32_mask(a, b); }
+  static reg select(mask m, reg a, reg b) { return _mm512_mask_blend_epi32(m, b, a); }
+  static ireg iselect(mask m, ireg a, ireg b) { return _mm512_mask_blend_epi32(m, b, a); }
+  static ireg iota()
+  {
+    return _mm512_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+  }
+  static ireg iset1(index_type i) { return _mm512_set1_epi32(i); }
+  static ireg iadd(ireg a, ireg b) { return _mm512_add_epi32(a, b); }
+  static void istore(index_type* p, ireg v) { store(p, v); }
+};
+
+template <> struct ops<std::int64_t> {
+  static constexpr bool enabled = true;
+  static constexpr std::size_t lanes = 8;
+  using reg = __m512i;
+  using mask = __mmask8;
+  using ireg = __m512i;
+  using index_type = std::int64_t;
+  static reg load(const void* p) { return _mm512_loadu_si512(p); }
+  static reg set1(std::int64_t x) { return _mm512_set1_epi64(x); }
+  static unsigned bits(mask m) { return m; }
+  static void store(void* p, reg v) { _mm512_storeu_si512(p, v); }
+  static mask lt(reg a, reg b) { return _mm512_cmplt_epi64_mask(a, b); }
+  static mask le(reg a, reg b) { return _mm512_cmple_epi64_mask(a, b); }
+  static reg select(mask m, reg a, reg b) { return _mm512_mask_blend_epi64(m, b, a); }
+  static ireg iselect(mask m, ireg a, ireg b) { return _mm512_mask_blend_epi64(m, b, a); }
+  static ireg iota() { return _mm512_setr_epi64(0, 1, 2, 3, 4, 5, 6, 7); }
+  static ireg iset1(index_type i) { return _mm512_set1_epi64(i); }
+  static ireg iadd(ireg a, ireg b) { return _mm512_add_epi64(a, b); }
+  static void istore(index_type* p, ireg v) { store(p, v); }
+};
+
+template <> struct ops<float> {
+  static constexpr bool enabled = true;
+  static constexpr std::size_t lanes = 16;
+  using reg = __m512;
+  using mask = __mmask16;
+  using ireg = __m512i;
+  using index_type = std::int32_t;
+  static reg load(const void* p) { return _mm512_loadu_ps(p); }
+  static reg set1(float x) { return _mm512_set1_ps(x); }
+  static void store(void* p, reg v) { _mm512_storeu_ps(p, v); }
+  static mask lt(reg a, reg b) { return _mm512_cmp_ps_mask(a, b, _CMP_LT_OQ); }
+  static mask le(reg a, reg b) { return _mm512_cmp_ps_mask(a, b, _CMP_LE_OQ); }
+  static reg select(mask m, reg a, reg b) { return _mm512_mask_blend_ps(m, b, a); }
+  static ireg iselect(mask m, ireg a, ireg b) { return _mm512_mask_blend_epi32(m, b, a); }
+  static ireg iota()
+  {
+    return _mm512_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+  }
+  static ireg iset1(index_type i) { return _mm512_set1_epi32(i); }
+  static ireg iadd(ireg a, ireg b) { return _mm512_add_epi32(a, b); }
+  static void istore(index_type* p, ireg v) { _mm512_storeu_si512(p, v); }
+  static mask isnan(reg a) { return _mm512_cmp_ps_mask(a, a, _CMP_UNORD_Q); }
+  static reg nan() { return _mm512_set1_ps(std::numeric_limits<float>::quiet_NaN()); }
+  static mask mor(mask a, mask b) { return static_cast<mask>(a | b); }
+  static mask mandnot(mask a, mask b) { return static_cast<mask>(a & ~b); }
+  static unsigned bits(mask m) { return m; }
+};
+
+template <> struct ops<double> {
+  static constexpr bool enabled = true;
+  static constexpr std::size_t lanes = 8;
+  using reg = __m512d;
+  using mask = __mmask8;
+  using ireg = __m512i;
+  using index_type = std::int64_t;
+  static reg load(const void* p) { return _mm512_loadu_pd(p); }
+  static reg set1(double x) { return _mm512_set1_pd(x); }
+  static void store(void* p, reg v) { _mm512_storeu_pd(p, v); }
+  static mask lt(reg a, reg b) { return _mm512_cmp_pd_mask(a, b, _CMP_LT_OQ); }
+  static mask le(reg a, reg b) { return _mm512_cmp_pd_mask(a, b, _CMP_LE_OQ); }
+  static reg select(mask m, reg a, reg b) { return _mm512_mask_blend_pd(m, b, a); }
+  static ireg iselect(mask m, ireg a, ireg b) { return _mm512_mask_blend_epi64(m, b, a); }
+  static ireg iota() { return _mm512_setr_epi64(0, 1, 2, 3, 4, 5, 6, 7); }
+  static ireg iset1(index_type i) { return _mm512_set1_epi64(i); }
+  static ireg iadd(ireg a, ireg b) { return _mm512_add_epi64(a, b); }
+  static void istore(index_type* p, ireg v) { _mm512_storeu_si512(p, v); }
+  static mask isnan(reg a) { return _mm512_cmp_pd_mask(a, a, _CMP_UNORD_Q); }
+  static reg nan() { return _mm512_set1_pd(std::numeric_limits<double>::quiet_NaN()); }
+  static mask mor(mask a, mask b) { return static_cast<mask>(a | b); }
+  static mask mandnot(mask a, mask b) { return static_cast<mask>(a & ~b); }
+  static unsigned bits(mask m) { return m; }
+};
+#endif
+
+/// Indica se existe kernel SIMD para o tipo de elemento `T` no nível ativo.
+template <class T, class Key = simd_key_t<T>>
+struct has_ops : std::bool_constant<ops<Key>::enabled> {};
+template <class T> struct has_ops<T, void> : std::false_type {};
+
+#if GRAAL_SIMD_LEVEL > 0
+/*
+ * Registrador "de bytes" do nível ativo, usado pelos kernels que só movem memória
+ * (reverse, byteswap, cópias), sem interpretar os elementos. `stream_bytes` grava sem
+ * passar pela cache e exige destino alinhado a `sizeof(bytes)`.
+ */
+# if GRAAL_SIMD_LEVEL == 3
+using bytes = __m512i;
+inline bytes load_bytes(const void* p) { return _mm512_loadu_si512(p); }
+inline void store_bytes(void* p, bytes v) { _mm512_storeu_si512(p, v); }
+inline void stream_bytes(void* p, bytes v) { _mm512_stream_si512(static_cast<__m512i*>(p), v); }
+# elif GRAAL_SIMD_LEVEL == 2
+using bytes = __m256i;
+inline bytes load_bytes(const void* p) { return _mm256_loadu_si256(static_cast<const __m256i*>(p)); }
+inline void store_bytes(void* p, bytes v) { _mm256_storeu_si256(static_cast<__m256i*>(p), v); }
+inline void stream_bytes(void* p, bytes v) { _mm256_stream_si256(static_cast<__m256i*>(p), v); }
+# else
+using bytes = __m128i;
+inline bytes load_bytes(const void* p) { return _mm_loadu_si128(static_cast<const __m128i*>(p)); }
+inline void store_bytes(void* p, bytes v) { _mm_storeu_si128(static_cast<__m128i*>(p), v); }
+inline void stream_bytes(void* p, bytes v) { _mm_stream_si128(static_cast<__m128i*>(p), v); }
+# endif
+
+/// Máscara de `pshufb` que inverte a ordem dos elementos de `S` bytes em 16 bytes.
+template <std::size_t S> inline __m128i reverse_pattern()
+{
+  alignas(16) unsigned char m[16];
+  for (std::size_t j = 0; j < 16; ++j) {
+    m[j] = static_cast<unsigned char>((16 / S - 1 - j / S) * S + j % S);
+  }
+  return _mm_load_si128(reinterpret_cast<const __m128i*>(m));
+}
+
+/// Inverte a ordem dos elementos de `S` bytes (1, 2, 4 ou 8) dentro de um registrador.
+template <std::size_t S> inline bytes reverse_lanes(bytes v)
+{
+  static_assert(S == 1 || S == 2 || S == 4 || S == 8, "tamanho de elemento sem kernel");
+# if GRAAL_SIMD_LEVEL == 3
+  if constexpr (S == 8) {
+    return _mm512_permutexvar_epi64(_mm512_setr_epi64(7, 6, 5, 4, 3, 2, 1, 0), v);
+  } else if constexpr (S == 4) {
+    return _mm512_permutexvar_epi32(
+      _mm512_setr_epi32(15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0), v);
+  } else {
+    // Inverte dentro de cada bloco de 16 bytes e depois a ordem dos 4 blocos.
+    v = _mm512_shuffle_epi8(v, _mm512_broadcast_i32x4(reverse_pattern<S>()));
+    return _mm512_shuffle_i64x2(v, v, 0x1B);
+  }
+# elif GRAAL_SIMD_LEVEL == 2
+  if constexpr (S == 8) {
+    return _mm256_permute4x64_epi64(v, 0x1B);
+  } else if constexpr (S == 4) {
+    return _mm256_permutevar8x32_epi32(v, _mm256_setr_epi32(7, 6, 5, 4, 3, 2, 1, 0));
+  } else {
+    // Inverte dentro de cada metade de 16 bytes e depois troca as metades.
+    v = _mm256_shuffle_epi8(v, _mm256_broadcastsi128_si256(reverse_pattern<S>()));
+    return _mm256_permute4x64_epi64(v, 0x4E);
+  }
+# else
+  if constexpr (S == 8) {
+    return _mm_shuffle_epi32(v, 0x4E);
+  } else if constexpr (S == 4) {
+    return _mm_shuffle_epi32(v, 0x1B);
+  } else {
+#  if defined(__SSSE3__)
+    return _mm_shuffle_epi8(v, reverse_pattern<S>());
+#  else
+    if constexpr (S == 1) {
+      // Sem pshufb: troca os bytes de cada palavra de 16 bits e cai no caso S == 2.
+      v = _mm_or_si128(_mm_slli_epi16(v, 8), _mm_srli_epi16(v, 8));
+    }
+    v = _mm_shufflehi_epi16(_mm_shufflelo_epi16(v, 0x1B), 0x1B);
+    return _mm_shuffle_epi32(v, 0x4E);
+#  endif
+  }
+# endif
+}
+
+/// Máscara de `pshufb` que inverte os bytes dentro de cada elemento de `S` bytes.
+template <std::size_t S> inline __m128i byteswap_pattern()
+{
+  alignas(16) unsigned char m[16];
+  for (std::size_t j = 0; j < 16; ++j) {
+    m[j] = static_cast<unsigned char>(j / S * S + (S - 1 - j % S));
+  }
+  return _mm_load_si128(reinterpret_cast<const __m128i*>(m));
+}
+
+/// Inverte os bytes dentro de cada elemento de `S` bytes (2, 4 ou 8) de um registrador.
+template <std::size_t S> inline bytes byteswap_lanes(bytes v)
+{
+  static_assert(S == 2 || S == 4 || S == 8, "tamanho de elemento sem kernel");
+# if GRAAL_SIMD_LEVEL == 3
+  return _mm512_shuffle_epi8(v, _mm512_broadcast_i32x4(byteswap_pattern<S>()));
+# elif GRAAL_SIMD_LEVEL == 2
+  return _mm256_shuffle_epi8(v, _mm256_broadcastsi128_si256(byteswap_pattern<S>()));
+# elif defined(__SSSE3__)
+  return _mm_shuffle_epi8(v, byteswap_pattern<S>());
+# else
+  // Sem pshufb: troca os bytes de cada palavra de 16 bits e depois reordena as palavras.
+  v = _mm_or_si128(_mm_slli_epi16(v, 8), _mm_srli_epi16(v, 8));
+  if constexpr (S == 4) {
+    v = _mm_shufflehi_epi16(_mm_shufflelo_epi16(v, 0xB1), 0xB1);
+  } else if constexpr (S == 8) {
+    v = _mm_shufflehi_epi16(_mm_shufflelo_epi16(v, 0x1B), 0x1B);
+  }
+  return v;
+# endif
+}
+
+/// Registrador com todas as lanes de `S` bytes iguais aos `S` bytes baixos de `x`.
+template <std::size_t S> inline bytes splat(std::uint64_t x)
+{
+  static_assert(S == 1 || S == 2 || S == 4 || S == 8, "tamanho de elemento sem kernel");
+# if GRAAL_SIMD_LEVEL == 3
+  if constexpr (S == 1) {
+    return _mm512_set1_epi8(static_cast<char>(x));
+  } else if constexpr (S == 2) {
+    return _mm512_set1_epi16(static_cast<short>(x));
+  } else if constexpr (S == 4) {
+    return _mm512_set1_epi32(static_cast<int>(x));
+  } else {
+    return _mm512_set1_epi64(static_cast<long long>(x));
+  }
+# elif GRAAL_SIMD_LEVEL == 2
+  if constexpr (S == 1) {
+    return _mm256_set1_epi8(static_cast<char>(x));
+  } else if constexpr (S == 2) {
+    return _mm256_set1_epi16(static_cast<short>(x));
+  } else if constexpr (S == 4) {
+    return _mm256_set1_epi32(static_cast<int>(x));
+  } else {
+    return _mm256_set1_epi64x(static_cast<long long>(x));
+  }
+# else
+  if constexpr (S == 1) {
+    return _mm_set1_epi8(static_cast<char>(x));
+  } else if constexpr (S == 2) {
+    return _mm_set1_epi16(static_cast<short>(x));
+  } else if constexpr (S == 4) {
+    return _mm_set1_epi32(static_cast<int>(x));
+  } else {
+    return _mm_set1_epi64x(static_cast<long long>(x));
+  }
+# endif
+}
+
+/// Bits que `eq_bits` usa por lane: um com AVX-512 (máscaras), um por byte nos demais.
+template <std::size_t S> constexpr std::size_t eq_bits_per_lane = GRAAL_SIMD_LEVEL == 3 ? 1 : S;
+
+/// Compara as lanes de `S` bytes de `a` e `b`; cada lane igual liga `eq_bits_per_lane<S>` bits.
+template <std::size_t S> inline std::uint64_t eq_bits(bytes a, bytes b)
+{
+  static_assert(S == 1 || S == 2 || S == 4 || S == 8, "tamanho de elemento sem kernel");
+# if GRAAL_SIMD_LEVEL == 3
+  if constexpr (S == 1) {
+    return _mm512_cmpeq_epi8_mask(a, b);
+  } else if constexpr (S == 2) {
+    return _mm512_cmpeq_epi16_mask(a, b);
+  } else if constexpr (S == 4) {
+    return _mm512_cmpeq_epi32_mask(a, b);
+  } else {
+    return _mm512_cmpeq_epi64_mask(a, b);
+  }
+# elif GRAAL_SIMD_LEVEL == 2
+  __m256i c;
+  if constexpr (S == 1) {
+    c = _mm256_cmpeq_epi8(a, b);
+  } else if constexpr (S == 2) {
+    c = _mm256_cmpeq_epi16(a, b);
+  } else if constexpr (S == 4) {
+    c = _mm256_cmpeq_epi32(a, b);
+  } else {
+    c = _mm256_cmpeq_epi64(a, b);
+  }
+  return static_cast<std::uint32_t>(_mm256_movemask_epi8(c));
+# else
+  __m128i c;
+  if constexpr (S == 1) {
+    c = _mm_cmpeq_epi8(a, b);
+  } else if constexpr (S == 2) {
+    c = _mm_cmpeq_epi16(a, b);
+  } else if constexpr (S == 4) {
+    c = _mm_cmpeq_epi32(a, b);
+  } else {
+#  if defined(__SSE4_1__)
+    c = _mm_cmpeq_epi64(a, b);
+#  else
+    // Sem pcmpeqq: as duas metades de 32 bits precisam ser iguais.
+    c = _mm_cmpeq_epi32(a, b);
+    c = _mm_and_si128(c, _mm_shuffle_epi32(c, 0xB1));
+#  endif
+  }
+  return static_cast<std::uint32_t>(_mm_movemask_epi8(c));
+# endif
+}
+
+# if GRAAL_SIMD_LEVEL >= 2
+/// Lê `base[idx[j]]` para cada lane `j`; índices e elementos têm `S` bytes (4 ou 8).
+template <std::size_t S> inline bytes gather(const void* base, bytes idx)
+{
+  static_assert(S == 4 || S == 8, "tamanho de elemento sem kernel");
+#  if GRAAL_SIMD_LEVEL == 3
+  if constexpr (S == 4) {
+    return _mm512_i32gather_epi32(idx, base, 4);
+  } else {
+    return _mm512_i64gather_epi64(idx, base, 8);
+  }
+#  else
+  if constexpr (S == 4) {
+    return _mm256_i32gather_epi32(static_cast<const int*>(base), idx, 4);
+  } else {
+    return _mm256_i64gather_epi64(static_cast<const long long*>(base), idx, 8);
+  }
+#  endif
+}
+# endif
+
+# if GRAAL_SIMD_LEVEL == 3
+/// Grava cada lane `j` de `v` em `base[idx[j]]`; com índices repetidos, vence a lane mais alta.
+template <std::size_t S> inline void scatter(void* base, bytes idx, bytes v)
+{
+  static_assert(S == 4 || S == 8, "tamanho de elemento sem kernel");
+  if constexpr (S == 4) {
+    _mm512_i32scatter_epi32(base, idx, v, 4);
+  } else {
+    _mm512_i64scatter_epi64(base, idx, v, 8);
+  }
+}
+# endif
+
+# if GRAAL_SIMD_LEVEL == 2
+/**
+ * Tabela do `compress_store` em AVX2: para cada máscara de lanes de `S` bytes, os índices
+ * (em palavras de 32 bits, um por byte) que levam as lanes selecionadas para o início.
+ */
+template <std::size_t S> struct compress_table {
+  static constexpr std::size_t lanes = 32 / S;
+  std::uint64_t idx[std::size_t{ 1 } << lanes]{};
+  constexpr compress_table()
+  {
+    for (std::size_t m = 0; m < (std::size_t{ 1 } << lanes); ++m) {
+      std::size_t out = 0;
+      for (std::size_t l = 0; l < lanes; ++l) {
+        if ((m >> l) & 1) {
+          for (std::size_t t = 0; t < S / 4; ++t, ++out) {
+            idx[m] |= static_cast<std::uint64_t>(l * (S / 4) + t) << (8 * out);
+          }
+        }
+      }
+    }
+  }
+};
+template <std::size_t S> inline constexpr compress_table<S> compress_lut{};
+# endif
+
+# if GRAAL_SIMD_LEVEL >= 2
+/**
+ * @brief Grava em `dst`, em sequência, as lanes de `S` bytes de `v` cujo bit em `bits` é 1.
+ *
+ * Com AVX-512 usa `vpcompress`; com AVX2, um shuffle tirado de uma tabela indexada pela
+ * máscara seguido de `maskstore`. Nunca grava além das lanes selecionadas.
+ *
+ * @return Quantas lanes foram gravadas.
+ */
+template <std::size_t S> inline std::size_t compress_store(void* dst, bytes v, unsigned bits)
+{
+  static_assert(S == 4 || S == 8, "tamanho de elemento sem kernel");
+#  if GRAAL_SIMD_LEVEL == 3
+  if constexpr (S == 4) {
+    _mm512_mask_compressstoreu_epi32(dst, static_cast<__mmask16>(bits), v);
+  } else {
+    _mm512_mask_compressstoreu_epi64(dst, static_cast<__mmask8>(bits), v);
+  }
+#  else
+  const __m256i perm = _mm256_cvtepu8_epi32(
+    _mm_cvtsi64_si128(static_cast<long long>(compress_lut<S>.idx[bits])));
+  const int words = __builtin_popcount(bits) * static_cast<int>(S / 4);
+  const __m256i keep = _mm256_cmpgt_epi32(_mm256_set1_epi32(words),
+                                          _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7));
+  _mm256_maskstore_epi32(static_cast<int*>(dst), keep, _mm256_permutevar8x32_epi32(v, perm));
+#  endif
+  return static_cast<std::size_t>(__builtin_popcount(bits));
+}
+# endif
+#endif
+
+/**
+ * @brief Kernel vetorial de argmin/argmax sobre `p[0, n)`, com `n >= lanes`.
+ *
+ * Cada lane guarda o menor/maior valor visto e o índice em que ele apareceu. A
+ * atualização do mínimo só acontece com comparação estrita e a do máximo também aceita
+ * igualdade, o que preserva "primeiro mínimo, último máximo" lane a lane; a redução
+ * horizontal desempata pelo índice.
+ *
+ * @tparam Dir +1 para ordenar por `<`, -1 para ordenar por `>`.
+ * @return Par de índices (mínimo, máximo) segundo a ordem `Dir`.
+ */
+template <int Dir, class T>
+std::pair<std::size_t, std::size_t> minmax_index(const T* p, std::size_t n)
+{
+  using V = ops<simd_key_t<T>>;
+  using index_type = typename V::index_type;
+  constexpr std::size_t L = V::lanes;
+  // Comparação escalar equivalente ao comparador original.
+  auto before = [](T a, T b) { return Dir > 0 ? a < b : b < a; };
+
+  typename V::reg vmin = V::load(p);
+  typename V::reg vmax = vmin;
+  typename V::ireg idx = V::iota();
+  typename V::ireg imin = idx;
+  typename V::ireg imax = idx;
+  const typename V::ireg step = V::iset1(static_cast<index_type>(L));
+
+  std::size_t i = L;
+  for (; i + L <= n; i += L) {
+    idx = V::iadd(idx, step);
+    auto v = V::load(p + i);
+    // Novo mínimo apenas se estritamente antes: mantém a primeira ocorrência.
+    auto m = Dir > 0 ? V::lt(v, vmin) : V::lt(vmin, v);
+    vmin = V::select(m, v, vmin);
+    imin = V::iselect(m, idx, imin);
+    // Novo máximo se não estiver antes do atual: empates vão para a última ocorrência.
+    auto M = Dir > 0 ? V::le(vmax, v) : V::le(v, vmax);
+    vmax = V::select(M, v, vmax);
+    imax = V::iselect(M, idx, imax);
+  }
+
+  // Redução horizontal das lanes, desempatando pelo índice.
+  T mins[L], maxs[L];
+  index_type imins[L], imaxs[L];
+  V::store(mins, vmin);
+  V::store(maxs, vmax);
+  V::istore(imins, imin);
+  V::istore(imaxs, imax);
+  std::size_t bmin = imins[0], bmax = imaxs[0];
+  T lo = mins[0], hi = maxs[0];
+  for (std::size_t l = 1; l < L; ++l) {
+    if (before(mins[l], lo) || (!before(lo, mins[l]) && std::size_t(imins[l]) < bmin)) {
+      lo = mins[l];
+      bmin = imins[l];
+    }
+    if (before(hi, maxs[l]) || (!before(maxs[l], hi) && std::size_t(imaxs[l]) > bmax)) {
+      hi = maxs[l];
+      bmax = imaxs[l];
+    }
+  }
+
+  // Cauda escalar com as mesmas regras de desempate.
+  for (; i < n; ++i) {
+    if (before(p[i], lo)) {
+      lo = p[i];
+      bmin = i;
+    }
+    if (!before(p[i], hi)) {
+      hi = p[i];
+      bmax = i;
+    }
+  }
+  return { bmin, bmax };
+}
+
+}  // namespace simd
+
+/**
+ * @brief Versão vetorial de `minmax` para ranges contíguos de tipos aritméticos.
+ *
+ * O range é processado em blocos que cabem no tipo de índice das lanes (32 bits para
+ * elementos de 4 bytes) e os resultados dos blocos são combinados mantendo o primeiro
+ * mínimo e o último máximo.
+ */
+template <int Dir, class T>
+std::pair<std::size_t, std::size_t> minmax_simd(const T* p, std::size_t n)
+{
+  constexpr std::size_t block = std::size_t(1) << 30;
+  auto before = [](const T& a, const T& b) { return Dir > 0 ? a < b : b < a; };
+  std::pair<std::size_t, std::size_t> best{ 0, 0 };
+  for (std::size_t start = 0; start < n; start += block) {
+    std::size_t len = std::min(block, n - start);
+    std::pair<std::size_t, std::size_t> r{ 0, 0 };
+    if (len >= simd::ops<simd_key_t<T>>::lanes) {
+      r = simd::minmax_index<Dir>(p + start, len);
+    } else {
+      // Bloco final curto demais para um vetor: varredura escalar.
+      for (std::size_t i = 1; i < len; ++i) {
+        if (before(p[start + i], p[start + r.first])) {
+          r.first = i;
+        }
+        if (!before(p[start + i], p[start + r.second])) {
+          r.second = i;
+        }
+      }
+    }
+    r.first += start;
+    r.second += start;
+    if (start == 0) {
+      best = r;
+      continue;
+    }
+    // Blocos posteriores só trocam o mínimo se forem estritamente menores.
+    if (before(p[r.first], p[best.first])) {
+      best.first = r.first;
+    }
+    if (!before(p[r.second], p[best.second])) {
+      best.second = r.second;
+    }
+  }
+  return best;
+}
+
+/// Verdadeiro quando `minmax(first, last, cmp)` pode usar `minmax_simd`.
+template <class Itr, class Compare, class T = typename std::iterator_traits<Itr>::value_type>
+constexpr bool minmax_simd_enabled = simd::has_ops<T>::value && is_contiguous_iterator<Itr>::value
+                                     && compare_direction<Compare, T>::value != 0;
+
+}  // namespace detail
+
+/// Políticas de execução aceitas pelas sobrecargas paralelas dos algoritmos.
+namespace execution {
+
+/// Execução sequencial na thread chamadora (equivale à sobrecarga sem política).
+struct sequenced_policy {};
+
+/**
+ * @brief Execução paralela: o range é dividido em blocos contíguos, um por thread.
+ *
+ * Ranges com menos de `2 * grain` elementos são processados na thread chamadora, pois o
+ * custo de criar threads supera o ganho.
+ */
+struct parallel_policy {
+  std::size_t threads{ 0 };       //!< Número de threads; 0 usa `hardware_concurrency()`.
+  std::size_t grain{ 1u << 16 };  //!< Menor quantidade de elementos atribuída a uma thread.
+};
+
+inline constexpr sequenced_policy seq{};
+inline constexpr parallel_policy par{};
+
+}  // namespace execution
+
+/// Indica se `T` é uma das políticas de `graal::execution`.
+template <class T> struct is_execution_policy : std::false_type {};
+template <> struct is_execution_policy<execution::sequenced_policy> : std::true_type {};
+template <> struct is_execution_policy<execution::parallel_policy> : std::true_type {};
+
+namespace detail {
+
+/// Habilita uma sobrecarga apenas quando `Policy` é uma política de execução.
+template <class Policy, class R>
+using enable_if_policy_t = std::enable_if_t<is_execution_policy<std::decay_t<Policy>>::value, R>;
+
+/// Número de blocos em que `n` elementos serão divididos segundo a política.
+inline std::size_t chunk_count(const execution::parallel_policy& policy, std::size_t n)
+{
+  std::size_t workers = policy.threads != 0 ? policy.threads : std::thread::hardware_concurrency();
+  std::size_t grain = std::max<std::size_t>(policy.grain, 1);
+  return std::max<std::size_t>(1, std::min(std::max<std::size_t>(workers, 1), n / grain));
+}
+
+/**
+ * @brief Executa `f(k, begin, end)` para cada bloco `k` de `[0, n)`, em paralelo.
+ *
+ * Os blocos têm tamanhos quase iguais e são ordenados: o bloco `k` cobre índices
+ * menores que o bloco `k + 1`. As fronteiras entre blocos são múltiplos de `align`
+ * (útil para que cada thread escreva linhas de cache inteiras). O bloco 0 roda na thread
+ * chamadora. Se algum bloco lançar exceção, a primeira (na ordem dos blocos) é relançada
+ * depois do `join`.
+ *
+ * @return O número de blocos usados.
+ */
+template <class F>
+std::size_t parallel_chunks(const execution::parallel_policy& policy,
+                            std::size_t n,
+                            F&& f,
+                            std::size_t align = 1)
+{
+  const std::size_t chunks = chunk_count(policy, n);
+  if (chunks == 1) {
+    f(std::size_t(0), std::size_t(0), n);
+    return 1;
+  }
+  auto bound = [&](std::size_t k) { return k == chunks ? n : n * k / chunks / align * align; };
+  std::vector<std::exception_ptr> errors(chunks);
+  auto run = [&](std::size_t k) {
+    try {
+      f(k, bound(k), bound(k + 1));
+    } catch (...) {
+      errors[k] = std::current_exception();
+    }
+  };
+  std::vector<std::thread> pool;
+  pool.reserve(chunks - 1);
+  for (std::size_t k = 1; k < chunks; ++k) {
+    pool.emplace_back(run, k);
+  }
+  run(0);
+  for (auto& t : pool) {
+    t.join();
+  }
+  for (auto& e : errors) {
+    if (e) {
+      std::rethrow_exception(e);
+    }
+  }
+  return chunks;
+}
+
+/// Verdadeiro se `It` é de acesso aleatório (requisito das versões paralelas).
+template <class It>
+constexpr bool is_random_access_v = std::is_base_of<
+  std::random_access_iterator_tag,
+  typename std::iterator_traits<It>::iterator_category>::value;
+
+}  // namespace detail
+
+/**
+ * @brief Encontra os elementos mínimo e máximo em um intervalo, usando um comparador personalizado.
+ * 
+ * Esta função encontra os elementos mínimo e máximo em um intervalo definido pelos iteradores 'first' e 'last',
+ * usando um comparador personalizado 'cmp' para determinar a ordem dos elementos.
+ * Em caso de empate, retorna o primeiro mínimo e o último máximo.
+ *
+ * Quando o range é contíguo, o elemento é aritmético (inteiro com sinal de 32/64 bits,
+ * `float` ou `double`) e o comparador é `std::less` ou `std::greater`, a busca é feita
+ * por um kernel SIMD (SSE/AVX2/AVX-512, conforme as flags de compilação). Nos demais
+ * casos os elementos são processados aos pares, com no máximo 3 comparações a cada 2
+ * elementos, e basta que `Itr` seja um iterador de avanço (forward).
+ * 
+ * @tparam Itr O tipo do iterador para o intervalo.
+ * @tparam Compare O tipo do comparador para ordenação.
+ * @param first Um iterador para o primeiro elemento do intervalo.
+ * @param last Um iterador para o último elemento do intervalo (exclusivo).
+ * @param cmp O comparador usado para determinar a ordem dos elementos. Deve retornar true se o primeiro elemento for considerado menor do que o segundo.
+ * @return Um par de iteradores, o primeiro apontando para o elemento mínimo e o segundo para o elemento máximo.
+ */
+
+template <typename Itr, typename Compare>
+std::pair<Itr, Itr> minmax(Itr first, Itr last, Compare cmp) {
+   if(first == last){
+    return std::make_pair(first, first);
+   }
+   using value_type = typename std::iterator_traits<Itr>::value_type;
+   if constexpr (detail::minmax_simd_enabled<Itr, Compare>) {
+    // Memória contígua, tipo aritmético e std::less/std::greater: usa o kernel vetorial.
+    auto r = detail::minmax_simd<detail::compare_direction<Compare, value_type>::value>(
+      detail::to_pointer(first), static_cast<std::size_t>(last - first));
+    return std::make_pair(first + r.first, first + r.second);
+   }
+   auto min_it = first;
+   auto max_it = first;
+   ++first;
+   // Percorre os elementos aos pares: o menor do par disputa o mínimo e o maior disputa
+   // o máximo, o que dá ~3 chamadas de cmp a cada 2 elementos. Só usa ++ e ==, então
+   // funciona com iteradores de avanço (forward).
+   while(first != last){
+    auto a = first;
+    if(++first == last){
+      // Elemento que sobrou sem par.
+      if(cmp(*a, *min_it)){
+        min_it = a;
+      } else if(!cmp(*a, *max_it)){
+        max_it = a;
+      }
+      break;
+    }
+    auto b = first++;
+    if(cmp(*b, *a)){
+      if(cmp(*b, *min_it)){
+        min_it = b;
+      }
+      if(!cmp(*a, *max_it)){
+        max_it = a;
+      }
+    } else {
+      // a <= b: em caso de empate, `a` (o anterior) concorre ao mínimo e `b` ao máximo.
+      if(cmp(*a, *min_it)){
+        min_it = a;
+      }
+      if(!cmp(*b, *max_it)){
+        max_it = b;
+      }
+    }
+   }
+
+  return std::make_pair(min_it, max_it);
+}
+
+/**
+ * @brief Versão de `minmax` com política de execução.
+ *
+ * Com `execution::par` e iteradores de acesso aleatório, o range é dividido em blocos
+ * contíguos, cada thread calcula o mínimo e o máximo do seu bloco (usando o kernel SIMD
+ * quando aplicável) e os resultados são combinados na ordem dos blocos. Um bloco
+ * posterior só substitui o mínimo se for estritamente menor, e substitui o máximo se não
+ * for menor, então o resultado é idêntico ao da versão sequencial.
+ *
+ * @tparam ExecutionPolicy `execution::sequenced_policy` ou `execution::parallel_policy`.
+ * @param policy A política de execução.
+ * @param first Um iterador para o primeiro elemento do intervalo.
+ * @param last Um iterador para o último elemento do intervalo (exclusivo).
+ * @param cmp O comparador usado para determinar a ordem dos elementos.
+ * @return Um par de iteradores, o primeiro apontando para o elemento mínimo e o segundo para o elemento máximo.
+ */
+template <typename ExecutionPolicy, typename Itr, typename Compare>
+detail::enable_if_policy_t<ExecutionPolicy, std::pair<Itr, Itr>>
+minmax(ExecutionPolicy&& policy, Itr first, Itr last, Compare cmp) {
+  using P = std::decay_t<ExecutionPolicy>;
+  if constexpr (!std::is_same<P, execution::parallel_policy>::value
+                || !detail::is_random_access_v<Itr>) {
+    // Sem paralelismo possível: recai na versão sequencial.
+    (void)policy;
+    return graal::minmax(first, last, cmp);
+  } else {
+    const std::size_t n = static_cast<std::size_t>(last - first);
+    std::vector<std::pair<Itr, Itr>> partial(detail::chunk_count(policy, n));
+    std::size_t chunks = detail::parallel_chunks(
+      policy, n, [&](std::size_t k, std::size_t b, std::size_t e) {
+        partial[k] = graal::minmax(first + b, first + e, cmp);
+      });
+    if (n == 0) {
+      return std::make_pair(first, first);
+    }
+    // Combinação determinística, na ordem dos blocos.
+    auto best = partial[0];
+    for (std::size_t k = 1; k < chunks; ++k) {
+      if (cmp(*partial[k].first, *best.first)) {
+        best.first = partial[k].first;
+      }
+      if (!cmp(*partial[k].second, *best.second)) {
+        best.second = partial[k].second;
+      }
+    }
+    return best;
+  }
+}
+
+/// Como `minmax` deve tratar valores NaN em ranges de ponto flutuante.
+enum class nan_policy {
+  ignore,     //!< NaNs são ignorados; se só houver NaNs, retorna `(last, last)`.
+  propagate,  //!< Se houver NaN, retorna o primeiro NaN como mínimo e como máximo.
+  largest     //!< NaN é maior que qualquer número (inclusive +inf); NaNs são equivalentes.
+};
+
+namespace detail {
+
+/// Estado da varredura NaN-aware: mínimo/máximo dos não-NaN e posições de NaN vistas.
+template <class T, class P> struct nan_minmax_state {
+  bool valid{ false };    //!< Já houve algum valor não-NaN.
+  bool has_nan{ false };  //!< Já houve algum NaN.
+  T lo{}, hi{};           //!< Valores do mínimo e do máximo atuais.
+  P imin{}, imax{};       //!< Posições do mínimo e do máximo atuais.
+  P first_nan{}, last_nan{};
+};
+
+/// Processa o valor `v` na posição `pos`, posterior a todas as já vistas.
+template <class T, class P> void nan_minmax_step(nan_minmax_state<T, P>& st, T v, P pos)
+{
+  if (v != v) {
+    if (!st.has_nan) {
+      st.first_nan = pos;
+      st.has_nan = true;
+    }
+    st.last_nan = pos;
+  } else if (!st.valid) {
+    st.lo = st.hi = v;
+    st.imin = st.imax = pos;
+    st.valid = true;
+  } else {
+    if (v < st.lo) {
+      st.lo = v;
+      st.imin = pos;
+    }
+    if (!(v < st.hi)) {
+      st.hi = v;
+      st.imax = pos;
+    }
+  }
+}
+
+/// Junta ao estado `st` o estado `later`, que cobre posições posteriores.
+template <class T, class P>
+void nan_minmax_merge(nan_minmax_state<T, P>& st, const nan_minmax_state<T, P>& later)
+{
+  if (later.valid) {
+    if (!st.valid) {
+      st.lo = later.lo;
+      st.hi = later.hi;
+      st.imin = later.imin;
+      st.imax = later.imax;
+      st.valid = true;
+    } else {
+      if (later.lo < st.lo) {
+        st.lo = later.lo;
+        st.imin = later.imin;
+      }
+      if (!(later.hi < st.hi)) {
+        st.hi = later.hi;
+        st.imax = later.imax;
+      }
+    }
+  }
+  if (later.has_nan) {
+    if (!st.has_nan) {
+      st.first_nan = later.first_nan;
+      st.has_nan = true;
+    }
+    st.last_nan = later.last_nan;
+  }
+}
+
+namespace simd {
+
+/**
+ * @brief Kernel vetorial NaN-aware sobre `p[0, n)`, com `n` múltiplo de `lanes`.
+ *
+ * As lanes começam com NaN (nenhum valor visto); um valor não-NaN entra no mínimo se for
+ * estritamente menor ou se a lane ainda estiver vazia, e no máximo se não for menor. A
+ * posição do último NaN também é acompanhada por lane, e a do primeiro NaN é registrada
+ * no primeiro bloco que contém algum. Com `Stop`, o kernel para nesse bloco, pois esse NaN
+ * é o resultado de `nan_policy::propagate`.
+ */
+template <bool Stop, class T>
+nan_minmax_state<T, std::size_t> minmax_nan_index(const T* p, std::size_t n)
+{
+  using V = ops<T>;
+  using index_type = typename V::index_type;
+  constexpr std::size_t L = V::lanes;
+  nan_minmax_state<T, std::size_t> st;
+
+  typename V::reg vlo = V::nan(), vhi = V::nan();
+  const typename V::ireg none = V::iset1(-1);
+  typename V::ireg ilo = none, ihi = none, inan = none;
+  typename V::ireg idx = V::iota();
+  const typename V::ireg step = V::iset1(static_cast<index_type>(L));
+
+  for (std::size_t i = 0; i < n; i += L, idx = V::iadd(idx, step)) {
+    auto v = V::load(p + i);
+    auto nanm = V::isnan(v);
+    if (!st.has_nan && V::bits(nanm) != 0) {
+      // Primeiro NaN do range, registrado em qualquer modo.
+      std::size_t lane = 0;
+      while (!(V::bits(nanm) >> lane & 1u)) {
+        ++lane;
+      }
+      st.has_nan = true;
+      st.first_nan = st.last_nan = i + lane;
+      if constexpr (Stop) {
+        return st;  // É tudo o que `propagate` precisa.
+      }
+    }
+    auto m = V::mor(V::lt(v, vlo), V::mandnot(V::isnan(vlo), nanm));
+    vlo = V::select(m, v, vlo);
+    ilo = V::iselect(m, idx, ilo);
+    auto M = V::mor(V::le(vhi, v), V::mandnot(V::isnan(vhi), nanm));
+    vhi = V::select(M, v, vhi);
+    ihi = V::iselect(M, idx, ihi);
+    inan = V::iselect(nanm, idx, inan);
+  }
+
+  // Redução horizontal: lanes vazias (índice -1) são ignoradas.
+  T los[L], his[L];
+  index_type ilos[L], ihis[L], inans[L];
+  V::store(los, vlo);
+  V::store(his, vhi);
+  V::istore(ilos, ilo);
+  V::istore(ihis, ihi);
+  V::istore(inans, inan);
+  for (std::size_t l = 0; l < L; ++l) {
+    if (ilos[l] >= 0) {
+      if (!st.valid || los[l] < st.lo || (!(st.lo < los[l]) && std::size_t(ilos[l]) < st.imin)) {
+        st.lo = los[l];
+        st.imin = ilos[l];
+      }
+      if (!st.valid || st.hi < his[l] || (!(his[l] < st.hi) && std::size_t(ihis[l]) > st.imax)) {
+        st.hi = his[l];
+        st.imax = ihis[l];
+      }
+      st.valid = true;
+    }
+    if (inans[l] >= 0 && (!st.has_nan || std::size_t(inans[l]) > st.last_nan)) {
+      st.last_nan = inans[l];
+      st.has_nan = true;
+    }
+  }
+  return st;
+}
+
+}  // namespace simd
+
+/// Varredura NaN-aware de um range contíguo, em blocos vetoriais mais uma cauda escalar.
+template <bool Stop, class T>
+nan_minmax_state<T, std::size_t> minmax_nan_simd(const T* p, std::size_t n)
+{
+  constexpr std::size_t L = simd::ops<T>::lanes;
+  constexpr std::size_t block = std::size_t(1) << 30;
+  nan_minmax_state<T, std::size_t> st;
+  std::size_t start = 0;
+  for (; n - start >= L; ) {
+    std::size_t len = std::min(block, (n - start) / L * L);
+    auto local = simd::minmax_nan_index<Stop>(p + start, len);
+    // Converte as posições locais do bloco em posições do range.
+    local.imin += start;
+    local.imax += start;
+    local.first_nan += start;
+    local.last_nan += start;
+    nan_minmax_merge(st, local);
+    start += len;
+    if (Stop && st.has_nan) {
+      return st;
+    }
+  }
+  for (; start < n; ++start) {
+    nan_minmax_step(st, p[start], start);
+    if (Stop && st.has_nan) {
+      break;
+    }
+  }
+  return st;
+}
+
+}  // namespace detail
+
+/**
+ * @brief Encontra o mínimo e o máximo de um range de ponto flutuante, tratando NaN explicitamente.
+ *
+ * Entre os valores não-NaN vale a ordem de `<`, com o primeiro mínimo e o último máximo.
+ * O tratamento de NaN segue @p policy (veja `graal::nan_policy`). Em ranges contíguos de
+ * `float` ou `double` a varredura é vetorizada; com `nan_policy::propagate` ela termina
+ * no primeiro NaN encontrado.
+ *
+ * @tparam Itr O tipo do iterador (de avanço) do range, com `value_type` de ponto flutuante.
+ * @param first Um iterador para o primeiro elemento do intervalo.
+ * @param last Um iterador para o último elemento do intervalo (exclusivo).
+ * @param policy Como tratar os NaNs.
+ * @return Um par de iteradores, o primeiro apontando para o elemento mínimo e o segundo para o elemento máximo.
+ */
+template <typename Itr>
+std::enable_if_t<std::is_floating_point<typename std::iterator_traits<Itr>::value_type>::value,
+                 std::pair<Itr, Itr>>
+minmax(Itr first, Itr last, nan_policy policy) {
+  using T = typename std::iterator_traits<Itr>::value_type;
+  if (first == last) {
+    return std::make_pair(first, first);
+  }
+  // Traduz o estado final para o par de iteradores, conforme a política.
+  auto finish = [&](const auto& st, auto at) {
+    switch (policy) {
+    case nan_policy::propagate:
+      if (st.has_nan) {
+        return std::make_pair(at(st.first_nan), at(st.first_nan));
+      }
+      break;
+    case nan_policy::largest:
+      // Só NaNs: o primeiro deles é o mínimo. Havendo NaN, o último é o máximo.
+      return std::make_pair(st.valid ? at(st.imin) : first,
+                            st.has_nan ? at(st.last_nan) : at(st.imax));
+    case nan_policy::ignore:
+      break;
+    }
+    return st.valid ? std::make_pair(at(st.imin), at(st.imax)) : std::make_pair(last, last);
+  };
+  if constexpr (detail::is_contiguous_iterator<Itr>::value && detail::simd::has_ops<T>::value) {
+    const T* p = detail::to_pointer(first);
+    const std::size_t n = static_cast<std::size_t>(last - first);
+    auto at = [first](std::size_t i) { return first + i; };
+    if (policy == nan_policy::propagate) {
+      return finish(detail::minmax_nan_simd<true>(p, n), at);
+    }
+    return finish(detail::minmax_nan_simd<false>(p, n), at);
+  } else {
+    detail::nan_minmax_state<T, Itr> st;
+    for (auto it = first; it != last; ++it) {
+      detail::nan_minmax_step(st, *it, it);
+      if (policy == nan_policy::propagate && st.has_nan) {
+        break;
+      }
+    }
+    return finish(st, [](Itr it) { return it; });
+  }
+}
+
+namespace detail {
+
+/**
+ * @brief Deque de capacidade fixa sobre um buffer circular.
+ *
+ * Usado pelas janelas deslizantes: como nunca há mais que `capacity` elementos vivos,
+ * não é preciso alocar a cada inserção, ao contrário de `std::deque`. Como em
+ * `std::deque`, o buffer é memória não inicializada e os elementos só são construídos
+ * na inserção, então `E` não precisa ser construível por padrão.
+ */
+template <class E> class ring_deque {
+  using traits = std::allocator_traits<std::allocator<E>>;
+
+public:
+  explicit ring_deque(std::size_t capacity)
+    : m_buf{ traits::allocate(m_alloc, capacity) }, m_capacity{ capacity }
+  {
+  }
+  ring_deque(const ring_deque& other) : ring_deque(other.m_capacity)
+  {
+    for (std::size_t i = 0; i < other.m_size; ++i) {
+      push_back(other.m_buf[other.index(i)]);
+    }
+  }
+  ring_deque(ring_deque&& other) noexcept
+    : m_buf{ std::exchange(other.m_buf, nullptr) },
+      m_capacity{ std::exchange(other.m_capacity, 0) },
+      m_head{ std::exchange(other.m_head, 0) },
+      m_size{ std::exchange(other.m_size, 0) }
+  {
+  }
+  ring_deque& operator=(ring_deque other) noexcept
+  {
+    std::swap(m_buf, other.m_buf);
+    std::swap(m_capacity, other.m_capacity);
+    std::swap(m_head, other.m_head);
+    std::swap(m_size, other.m_size);
+    return *this;
+  }
+  ~ring_deque()
+  {
+    clear();
+    if (m_buf != nullptr) {
+      traits::deallocate(m_alloc, m_buf, m_capacity);
+    }
+  }
+
+  bool empty() const { return m_size == 0; }
+  E& front() { return m_buf[m_head]; }
+  const E& front() const { return m_buf[m_head]; }
+  E& back() { return m_buf[index(m_size - 1)]; }
+  const E& back() const { return m_buf[index(m_size - 1)]; }
+  void push_back(E e)
+  {
+    traits::construct(m_alloc, m_buf + index(m_size), std::move(e));
+    ++m_size;
+  }
+  void pop_back()
+  {
+    --m_size;
+    traits::destroy(m_alloc, m_buf + index(m_size));
+  }
+  void pop_front()
+  {
+    traits::destroy(m_alloc, m_buf + m_head);
+    m_head = index(1);
+    --m_size;
+  }
+  void clear()
+  {
+    while (!empty()) {
+      pop_back();
+    }
+    m_head = 0;
+  }
+
+private:
+  std::size_t index(std::size_t offset) const
+  {
+    std::size_t i = m_head + offset;
+    return i >= m_capacity ? i - m_capacity : i;
+  }
+  std::allocator<E> m_alloc;
+  E* m_buf;
+  std::size_t m_capacity;
+  std::size_t m_head{ 0 };
+  std::size_t m_size{ 0 };
+};
+
+/// Adapta um comparador de valores para comparar os valores apontados por iteradores.
+template <class Compare> struct deref_compare {
+  Compare cmp;
+  template <class It> bool operator()(const It& a, const It& b) const { return cmp(*a, *b); }
+};
+
+}  // namespace detail
+
+/**
+ * @brief Mínimo e máximo dos últimos `W` elementos de um fluxo.
+ *
+ * Mantém duas filas monotônicas: a do mínimo guarda valores em ordem crescente (segundo
+ * `cmp`) e a do máximo em ordem decrescente. Cada elemento entra e sai de cada fila no
+ * máximo uma vez, então `push` custa O(1) amortizado e `min`/`max` custam O(1).
+ *
+ * Segue as mesmas regras de `graal::minmax`: entre elementos equivalentes da janela,
+ * `min()` é o que entrou primeiro e `max()` o que entrou por último.
+ *
+ * @tparam T O tipo dos elementos do fluxo.
+ * @tparam Compare O comparador; deve retornar true se o primeiro for menor que o segundo.
+ */
+template <class T, class Compare = std::less<>> class sliding_window_minmax {
+public:
+  /// Iterador de saída: cada `*it = v` faz `push(v)` na janela.
+  class sink_iterator {
+  public:
+    using iterator_category = std::output_iterator_tag;
+    using value_type = void;
+    using difference_type = std::ptrdiff_t;
+    using pointer = void;
+    using reference = void;
+
+    explicit sink_iterator(sliding_window_minmax& w) : m_window{ &w } {}
+    sink_iterator& operator=(const T& value)
+    {
+      m_window->push(value);
+      return *this;
+    }
+    sink_iterator& operator*() { return *this; }
+    sink_iterator& operator++() { return *this; }
+    sink_iterator& operator++(int) { return *this; }
+
+  private:
+    sliding_window_minmax* m_window;
+  };
+
+  /**
+   * @brief Cria uma janela vazia.
+   * @param window O tamanho da janela (W), que deve ser maior que zero.
+   * @param cmp O comparador usado para ordenar os elementos.
+   */
+  explicit sliding_window_minmax(std::size_t window, Compare cmp = Compare{})
+    : m_window{ window }, m_cmp{ cmp }, m_min{ window }, m_max{ window }
+  {
+    if (window == 0) {
+      throw std::invalid_argument("sliding_window_minmax: window must be positive");
+    }
+  }
+
+  /// Insere `value` no fim da janela, descartando o elemento que sai pelo início.
+  void push(const T& value)
+  {
+    const std::size_t idx = m_count++;
+    // Remove da frente os elementos que saíram da janela.
+    if (idx >= m_window) {
+      const std::size_t oldest = idx - m_window;
+      if (!m_min.empty() && m_min.front().first <= oldest) {
+        m_min.pop_front();
+      }
+      if (!m_max.empty() && m_max.front().first <= oldest) {
+        m_max.pop_front();
+      }
+    }
+    // Fila do mínimo: só remove os estritamente maiores, para manter o primeiro mínimo.
+    while (!m_min.empty() && m_cmp(value, m_min.back().second)) {
+      m_min.pop_back();
+    }
+    m_min.push_back({ idx, value });
+    // Fila do máximo: remove também os equivalentes, para manter o último máximo.
+    while (!m_max.empty() && !m_cmp(value, m_max.back().second)) {
+      m_max.pop_back();
+    }
+    m_max.push_back({ idx, value });
+  }
+
+  /// O menor elemento da janela. Requer `!empty()`.
+  const T& min() const { return m_min.front().second; }
+  /// O maior elemento da janela. Requer `!empty()`.
+  const T& max() const { return m_max.front().second; }
+  /// Posição (contada desde o primeiro `push`) do menor elemento da janela.
+  std::size_t min_index() const { return m_min.front().first; }
+  /// Posição (contada desde o primeiro `push`) do maior elemento da janela.
+  std::size_t max_index() const { return m_max.front().first; }
+
+  /// Quantidade de elementos atualmente na janela.
+  std::size_t size() const { return std::min(m_count, m_window); }
+  /// O tamanho máximo da janela (W).
+  std::size_t window() const { return m_window; }
+  bool empty() const { return m_count == 0; }
+  /// Verdadeiro quando a janela já recebeu pelo menos W elementos.
+  bool full() const { return m_count >= m_window; }
+
+  /// Esvazia a janela.
+  void clear()
+  {
+    m_count = 0;
+    m_min.clear();
+    m_max.clear();
+  }
+
+  /// Iterador de saída que alimenta esta janela.
+  sink_iterator sink() { return sink_iterator{ *this }; }
+
+private:
+  std::size_t m_window;
+  Compare m_cmp;
+  std::size_t m_count{ 0 };  //!< Total de elementos já inseridos.
+  /// Filas monotônicas de pares (posição, valor).
+  detail::ring_deque<std::pair<std::size_t, T>> m_min, m_max;
+};
+
+/**
+ * @brief Calcula `minmax` de cada janela de `window` elementos consecutivos de um range.
+ *
+ * Para cada janela completa `[first + k, first + k + window)` escreve em @p d_first o par
+ * de iteradores que `graal::minmax` retornaria para ela, em O(n) no total em vez de
+ * O(n·W). Se o range tem menos que `window` elementos, nada é escrito.
+ *
+ * @tparam ForwardIt O tipo do iterador (de avanço) do range.
+ * @tparam OutputIt Iterador de saída que aceita `std::pair<ForwardIt, ForwardIt>`.
+ * @tparam Compare O comparador usado para ordenar os elementos.
+ * @param first Um iterador para o primeiro elemento do intervalo.
+ * @param last Um iterador para o último elemento do intervalo (exclusivo).
+ * @param window O tamanho da janela, maior que zero.
+ * @param d_first O início do destino.
+ * @param cmp O comparador usado para determinar a ordem dos elementos.
+ * @return O iterador de saída após o último par escrito.
+ */
+template <class ForwardIt, class OutputIt, class Compare>
+OutputIt sliding_minmax(ForwardIt first,
+                        ForwardIt last,
+                        std::size_t window,
+                        OutputIt d_first,
+                        Compare cmp)
+{
+  // A janela guarda iteradores e compara os valores apontados por eles.
+  sliding_window_minmax<ForwardIt, detail::deref_compare<Compare>> w{
+    window, detail::deref_compare<Compare>{ cmp }
+  };
+  for (; first != last; ++first) {
+    w.push(first);
+    if (w.full()) {
+      *d_first = std::make_pair(w.min(), w.max());
+      ++d_first;
+    }
+  }
+  return d_first;
+}
+
+namespace detail {
+
+/// Parte inteira de log2(n), para n > 0.
+inline std::size_t floor_log2(std::size_t n)
+{
+#if defined(__GNUC__)
+  return static_cast<std::size_t>(63 - __builtin_clzll(static_cast<unsigned long long>(n)));
+#else
+  std::size_t k = 0;
+  while (n >>= 1) {
+    ++k;
+  }
+  return k;
+#endif
+}
+
+}  // namespace detail
+
+/**
+ * @brief Índice para consultas repetidas de mínimo e máximo em sub-ranges de um range fixo.
+ *
+ * O range é dividido em blocos de `block_size` elementos. Para cada bloco guardamos o
+ * mínimo e o máximo, e sobre esses resumos construímos uma *sparse table*. Uma consulta
+ * `minmax(i, j)` varre no máximo dois blocos parciais (com `graal::minmax`) e consulta a
+ * tabela em O(1) para os blocos completos do meio, ou seja, custo O(block_size) constante.
+ * A memória extra é O((n / block_size) · log(n / block_size)).
+ *
+ * O índice não copia os elementos: o range original não pode ser alterado nem destruído
+ * enquanto o índice for usado.
+ *
+ * @tparam RandomIt Iterador de acesso aleatório do range indexado.
+ * @tparam Compare O comparador; deve retornar true se o primeiro for menor que o segundo.
+ */
+template <class RandomIt, class Compare = std::less<>> class range_minmax {
+public:
+  /// Quantidade de elementos resumidos por bloco.
+  static constexpr std::size_t block_size = 64;
+
+  /**
+   * @brief Constrói o índice em O(n).
+   * @param first Um iterador para o primeiro elemento do intervalo.
+   * @param last Um iterador para o último elemento do intervalo (exclusivo).
+   * @param cmp O comparador usado para determinar a ordem dos elementos.
+   */
+  range_minmax(RandomIt first, RandomIt last, Compare cmp = Compare{})
+    : m_first{ first }, m_size{ static_cast<std::size_t>(last - first) }, m_cmp{ cmp }
+  {
+    const std::size_t nb = (m_size + block_size - 1) / block_size;
+    if (nb == 0) {
+      return;
+    }
+    // Nível 0: mínimo e máximo de cada bloco, guardados como índices de elemento.
+    m_blk_min.resize(nb);
+    m_blk_max.resize(nb);
+    for (std::size_t b = 0; b < nb; ++b) {
+      auto begin = m_first + b * block_size;
+      auto r = graal::minmax(begin, begin + std::min(block_size, m_size - b * block_size), m_cmp);
+      m_blk_min[b] = static_cast<std::size_t>(r.first - m_first);
+      m_blk_max[b] = static_cast<std::size_t>(r.second - m_first);
+    }
+    // Nível k: melhor bloco em [b, b + 2^k), combinando dois intervalos disjuntos do nível k-1.
+    const std::size_t levels = detail::floor_log2(nb) + 1;
+    m_min.resize(levels);
+    m_max.resize(levels);
+    m_min[0].resize(nb);
+    m_max[0].resize(nb);
+    for (std::size_t b = 0; b < nb; ++b) {
+      m_min[0][b] = m_max[0][b] = static_cast<std::uint32_t>(b);
+    }
+    for (std::size_t k = 1; k < levels; ++k) {
+      const std::size_t half = std::size_t(1) << (k - 1);
+      const std::size_t count = nb - (std::size_t(1) << k) + 1;
+      m_min[k].resize(count);
+      m_max[k].resize(count);
+      for (std::size_t b = 0; b < count; ++b) {
+        m_min[k][b] = pick_min_block(m_min[k - 1][b], m_min[k - 1][b + half]);
+        m_max[k][b] = pick_max_block(m_max[k - 1][b], m_max[k - 1][b + half]);
+      }
+    }
+  }
+
+  /// Quantidade de elementos indexados.
+  std::size_t size() const { return m_size; }
+
+  /**
+   * @brief Mínimo e máximo do sub-range `[i, j)`.
+   *
+   * Retorna os mesmos iteradores que `graal::minmax(first + i, first + j, cmp)`: o
+   * primeiro mínimo e o último máximo. Se `i == j`, retorna `(first + i, first + i)`.
+   *
+   * @param i Posição inicial (inclusiva), com `i <= j`.
+   * @param j Posição final (exclusiva), com `j <= size()`.
+   * @return Um par de iteradores, o primeiro apontando para o elemento mínimo e o segundo para o elemento máximo.
+   */
+  std::pair<RandomIt, RandomIt> minmax(std::size_t i, std::size_t j) const
+  {
+    const std::size_t bi = (i + block_size - 1) / block_size;  // Primeiro bloco completo.
+    const std::size_t bj = j / block_size;                     // Fim dos blocos completos.
+    if (bi >= bj) {
+      // Nenhum bloco completo no meio: varredura direta.
+      return graal::minmax(m_first + i, m_first + j, m_cmp);
+    }
+    // Blocos completos: duas entradas (possivelmente sobrepostas) da sparse table.
+    const std::size_t k = detail::floor_log2(bj - bi);
+    const std::size_t right = bj - (std::size_t(1) << k);
+    std::size_t lo = m_blk_min[pick_min_block(m_min[k][bi], m_min[k][right])];
+    std::size_t hi = m_blk_max[pick_max_block(m_max[k][bi], m_max[k][right])];
+    // Parte inicial, antes dos blocos completos: vence empates do mínimo.
+    if (i < bi * block_size) {
+      auto r = graal::minmax(m_first + i, m_first + bi * block_size, m_cmp);
+      const std::size_t a = static_cast<std::size_t>(r.first - m_first);
+      const std::size_t b = static_cast<std::size_t>(r.second - m_first);
+      lo = earlier_min(a, lo);
+      hi = earlier_max(b, hi);
+    }
+    // Parte final, depois dos blocos completos: vence empates do máximo.
+    if (bj * block_size < j) {
+      auto r = graal::minmax(m_first + bj * block_size, m_first + j, m_cmp);
+      const std::size_t a = static_cast<std::size_t>(r.first - m_first);
+      const std::size_t b = static_cast<std::size_t>(r.second - m_first);
+      lo = earlier_min(lo, a);
+      hi = earlier_max(hi, b);
+    }
+    return std::make_pair(m_first + lo, m_first + hi);
+  }
+
+private:
+  /// Entre os elementos `a` (anterior) e `b` (posterior), o mínimo; empate fica com `a`.
+  std::size_t earlier_min(std::size_t a, std::size_t b) const
+  {
+    return m_cmp(m_first[b], m_first[a]) ? b : a;
+  }
+  /// Entre os elementos `a` (anterior) e `b` (posterior), o máximo; empate fica com `b`.
+  std::size_t earlier_max(std::size_t a, std::size_t b) const
+  {
+    return m_cmp(m_first[b], m_first[a]) ? a : b;
+  }
+  std::uint32_t pick_min_block(std::uint32_t a, std::uint32_t b) const
+  {
+    return earlier_min(m_blk_min[a], m_blk_min[b]) == m_blk_min[a] ? a : b;
+  }
+  std::uint32_t pick_max_block(std::uint32_t a, std::uint32_t b) const
+  {
+    return earlier_max(m_blk_max[a], m_blk_max[b]) == m_blk_max[b] ? b : a;
+  }
+
+  RandomIt m_first;
+  std::size_t m_size;
+  Compare m_cmp;
+  std::vector<std::size_t> m_blk_min;  //!< Índice do mínimo de cada bloco.
+  std::vector<std::size_t> m_blk_max;  //!< Índice do máximo de cada bloco.
+  /// Sparse tables de blocos: `m_min[k][b]` é o bloco vencedor em `[b, b + 2^k)`.
+  std::vector<std::vector<std::uint32_t>> m_min, m_max;
+};
+
+namespace detail {
+
+/// Tipo do membro apontado por um ponteiro para membro de dados, sem `const`/`volatile`
+/// (`const M S::*` -> `M`), para que possa ser copiado para um buffer local.
+template <class P> struct member_type {
+  using type = void;
+};
+template <class M, class S> struct member_type<M S::*> {
+  using type = std::remove_cv_t<M>;
+};
+
+/// Verdadeiro se todas as projeções são ponteiros para membros com kernel SIMD.
+template <class Itr, class... Proj>
+constexpr bool minmax_multi_simd_enabled
+  = is_contiguous_iterator<Itr>::value
+    && (... && (std::is_member_object_pointer<Proj>::value
+                && simd::has_ops<typename member_type<Proj>::type>::value));
+
+/**
+ * @brief `minmax_multi` para membros aritméticos de structs em memória contígua.
+ *
+ * O range é percorrido em blocos de `tile` structs. Em cada bloco, cada campo é copiado
+ * para um buffer contíguo (que fica no cache L1) e reduzido pelo kernel SIMD de
+ * `minmax`; o resultado do bloco é então combinado com o acumulado. Assim a memória
+ * principal é lida uma única vez para todos os campos.
+ */
+template <class Itr, class... Proj, std::size_t... I>
+void minmax_multi_tiled(Itr first,
+                        std::size_t n,
+                        std::array<std::pair<Itr, Itr>, sizeof...(Proj)>& result,
+                        const std::tuple<Proj...>& projs,
+                        std::index_sequence<I...>)
+{
+  constexpr std::size_t tile = 256;
+  const auto* p = to_pointer(first);
+  auto reduce_field = [&](std::size_t start, std::size_t len, auto proj, auto& r) {
+    using M = typename member_type<decltype(proj)>::type;
+    M buf[tile];
+    for (std::size_t t = 0; t < len; ++t) {
+      buf[t] = p[start + t].*proj;
+    }
+    auto local = minmax_simd<1>(buf, len);
+    // Blocos posteriores trocam o mínimo só se menor, e o máximo se não for menor.
+    if (start == 0 || buf[local.first] < (*r.first).*proj) {
+      r.first = first + (start + local.first);
+    }
+    if (start == 0 || !(buf[local.second] < (*r.second).*proj)) {
+      r.second = first + (start + local.second);
+    }
+  };
+  for (std::size_t start = 0; start < n; start += tile) {
+    const std::size_t len = std::min(tile, n - start);
+    (reduce_field(start, len, std::get<I>(projs), result[I]), ...);
+  }
+}
+
+/// Atualiza o mínimo e o máximo da projeção `proj` com o par `a`, `b` (`a` antes de `b`).
+template <class Itr, class Proj>
+void minmax_multi_pair(std::pair<Itr, Itr>& r, const Proj& proj, Itr a, Itr b)
+{
+  const auto& va = std::invoke(proj, *a);
+  const auto& vb = std::invoke(proj, *b);
+  if (vb < va) {
+    if (vb < std::invoke(proj, *r.first)) {
+      r.first = b;
+    }
+    if (!(va < std::invoke(proj, *r.second))) {
+      r.second = a;
+    }
+  } else {
+    if (va < std::invoke(proj, *r.first)) {
+      r.first = a;
+    }
+    if (!(vb < std::invoke(proj, *r.second))) {
+      r.second = b;
+    }
+  }
+}
+
+/// Atualiza o mínimo e o máximo da projeção `proj` com um elemento isolado `a`.
+template <class Itr, class Proj>
+void minmax_multi_single(std::pair<Itr, Itr>& r, const Proj& proj, Itr a)
+{
+  const auto& va = std::invoke(proj, *a);
+  if (va < std::invoke(proj, *r.first)) {
+    r.first = a;
+  } else if (!(va < std::invoke(proj, *r.second))) {
+    r.second = a;
+  }
+}
+
+template <class Itr, class... Proj, std::size_t... I>
+void minmax_multi_generic(Itr first,
+                          Itr last,
+                          std::array<std::pair<Itr, Itr>, sizeof...(Proj)>& result,
+                          const std::tuple<Proj...>& projs,
+                          std::index_sequence<I...>)
+{
+  ++first;
+  // Mesmo esquema aos pares de `graal::minmax`, aplicado a todas as projeções por elemento.
+  while (first != last) {
+    auto a = first;
+    if (++first == last) {
+      (minmax_multi_single(result[I], std::get<I>(projs), a), ...);
+      break;
+    }
+    auto b = first++;
+    (minmax_multi_pair(result[I], std::get<I>(projs), a, b), ...);
+  }
+}
+
+}  // namespace detail
+
+/**
+ * @brief Mínimo e máximo de vários campos (projeções) de cada elemento, em uma única passada.
+ *
+ * Equivale a chamar `graal::minmax` uma vez por projeção, comparando `std::invoke(proj,
+ * *it)` com `<`, mas percorre o range uma só vez. Quando o range é contíguo e todas as
+ * projeções são ponteiros para membros aritméticos (ex.: `&Row::latency`), os campos são
+ * reduzidos em blocos pelo kernel SIMD.
+ *
+ * @tparam Itr O tipo do iterador (de avanço) do range.
+ * @tparam Proj Os tipos das projeções: ponteiros para membros ou funções unárias.
+ * @param first Um iterador para o primeiro elemento do intervalo.
+ * @param last Um iterador para o último elemento do intervalo (exclusivo).
+ * @param proj As projeções, aplicadas a cada elemento.
+ * @return Um `std::array` com um par (mínimo, máximo) de iteradores por projeção, na ordem dada.
+ */
+template <class Itr, class... Proj>
+std::array<std::pair<Itr, Itr>, sizeof...(Proj)> minmax_multi(Itr first, Itr last, Proj... proj)
+{
+  std::array<std::pair<Itr, Itr>, sizeof...(Proj)> result;
+  result.fill(std::make_pair(first, first));
+  if (first == last) {
+    return result;
+  }
+  std::tuple<Proj...> projs{ proj... };
+  if constexpr (detail::minmax_multi_simd_enabled<Itr, Proj...>) {
+    detail::minmax_multi_tiled(first,
+                               static_cast<std::size_t>(last - first),
+                               result,
+                               projs,
+                               std::index_sequence_for<Proj...>{});
+  } else {
+    detail::minmax_multi_generic(first, last, result, projs, std::index_sequence_for<Proj...>{});
+  }
+  return result;
+}
+
+/**
+ * @brief Sketch de quantis em uma passada, com memória limitada e mesclável (estilo KLL).
+ *
+ * Os elementos são guardados em uma pilha de "compactadores": o nível `h` contém amostras
+ * que representam `2^h` elementos cada. Quando um nível enche, ele é ordenado e metade das
+ * amostras (as de posição par ou ímpar, sorteada) sobe para o nível seguinte. A memória
+ * fica em O(k) e o erro de posto de `quantile(q)` fica em torno de `1.7 / k` do total.
+ * O menor e o maior elementos são mantidos exatamente, como em `graal::minmax`.
+ *
+ * O sketch não é thread-safe: em código paralelo, use um sketch por thread e combine-os com
+ * `merge`.
+ *
+ * @tparam T O tipo dos elementos.
+ * @tparam Compare O comparador; deve retornar true se o primeiro for menor que o segundo.
+ */
+template <class T, class Compare = std::less<>> class quantile_sketch {
+public:
+  /**
+   * @brief Cria um sketch vazio.
+   * @param k Parâmetro de precisão (capacidade do maior compactador), no mínimo 8.
+   * @param cmp O comparador usado para ordenar os elementos.
+   */
+  explicit quantile_sketch(std::size_t k = 200, Compare cmp = Compare{})
+    : m_k{ std::max<std::size_t>(k, 8) }, m_cmp{ cmp }, m_levels(1)
+  { /* empty */
+  }
+
+  /// Cria um sketch com os elementos de `[first, last)`.
+  template <class InputIt>
+  quantile_sketch(InputIt first, InputIt last, std::size_t k = 200, Compare cmp = Compare{})
+    : quantile_sketch(k, cmp)
+  {
+    push(first, last);
+  }
+
+  /// Insere um elemento.
+  void push(const T& value)
+  {
+    if (m_count == 0 || m_cmp(value, m_min)) {
+      m_min = value;
+    }
+    if (m_count == 0 || !m_cmp(value, m_max)) {
+      m_max = value;
+    }
+    ++m_count;
+    m_levels[0].push_back(value);
+    if (m_levels[0].size() >= capacity(0)) {
+      compress();
+    }
+  }
+
+  /// Insere todos os elementos de `[first, last)`.
+  template <class InputIt> void push(InputIt first, InputIt last)
+  {
+    for (; first != last; ++first) {
+      push(*first);
+    }
+  }
+
+  /// Acrescenta a este sketch os elementos resumidos por `other`.
+  void merge(const quantile_sketch& other)
+  {
+    if (other.m_count == 0) {
+      return;
+    }
+    if (m_count == 0 || m_cmp(other.m_min, m_min)) {
+      m_min = other.m_min;
+    }
+    if (m_count == 0 || !m_cmp(other.m_max, m_max)) {
+      m_max = other.m_max;
+    }
+    m_count += other.m_count;
+    if (m_levels.size() < other.m_levels.size()) {
+      m_levels.resize(other.m_levels.size());
+    }
+    for (std::size_t h = 0; h < other.m_levels.size(); ++h) {
+      m_levels[h].insert(m_levels[h].end(), other.m_levels[h].begin(), other.m_levels[h].end());
+    }
+    compress();
+  }
+
+  /**
+   * @brief Valor aproximado do quantil `q`.
+   *
+   * `quantile(0)` e `quantile(1)` retornam exatamente o menor e o maior elemento.
+   *
+   * @param q A fração desejada, em `[0, 1]` (ex.: 0.99 para p99). Requer `!empty()`.
+   * @return Um elemento inserido cujo posto aproxima `q · size()`.
+   */
+  T quantile(double q) const
+  {
+    if (q <= 0) {
+      return m_min;
+    }
+    if (q >= 1) {
+      return m_max;
+    }
+    // Amostras ponderadas por 2^h, ordenadas por valor.
+    std::vector<std::pair<T, std::uint64_t>> samples;
+    for (std::size_t h = 0; h < m_levels.size(); ++h) {
+      for (const auto& v : m_levels[h]) {
+        samples.emplace_back(v, std::uint64_t(1) << h);
+      }
+    }
+    std::sort(samples.begin(), samples.end(), [this](const auto& a, const auto& b) {
+      return m_cmp(a.first, b.first);
+    });
+    std::uint64_t total = 0;
+    for (const auto& s : samples) {
+      total += s.second;
+    }
+    const double target = q * static_cast<double>(total);
+    std::uint64_t acc = 0;
+    for (const auto& s : samples) {
+      acc += s.second;
+      if (static_cast<double>(acc) >= target) {
+        return s.first;
+      }
+    }
+    return m_max;
+  }
+
+  /// Quantidade de elementos inseridos (incluindo os de sketches mesclados).
+  std::uint64_t size() const { return m_count; }
+  bool empty() const { return m_count == 0; }
+  /// O menor elemento inserido. Requer `!empty()`.
+  const T& min() const { return m_min; }
+  /// O maior elemento inserido. Requer `!empty()`.
+  const T& max() const { return m_max; }
+
+  /// Quantidade de amostras atualmente guardadas (a memória usada pelo sketch).
+  std::size_t retained() const
+  {
+    std::size_t r = 0;
+    for (const auto& level : m_levels) {
+      r += level.size();
+    }
+    return r;
+  }
+
+private:
+  /// Capacidade do nível `h`: decresce com fator 2/3 do nível mais alto para os mais baixos.
+  std::size_t capacity(std::size_t h) const
+  {
+    const std::size_t depth = m_levels.size() - 1 - h;
+    double c = static_cast<double>(m_k);
+    for (std::size_t i = 0; i < depth && c >= 2; ++i) {
+      c *= 2.0 / 3.0;
+    }
+    return std::max<std::size_t>(2, static_cast<std::size_t>(c));
+  }
+
+  /// Compacta, de baixo para cima, todos os níveis acima da capacidade.
+  void compress()
+  {
+    for (std::size_t h = 0; h < m_levels.size(); ++h) {
+      if (m_levels[h].size() < capacity(h)) {
+        continue;
+      }
+      if (h + 1 == m_levels.size()) {
+        m_levels.emplace_back();
+      }
+      auto& level = m_levels[h];
+      std::sort(level.begin(), level.end(), m_cmp);
+      // Com tamanho ímpar, o último elemento fica no nível para não perder peso.
+      T leftover{};
+      const bool odd = level.size() % 2 != 0;
+      if (odd) {
+        leftover = std::move(level.back());
+        level.pop_back();
+      }
+      // Sobe metade das amostras, começando na posição par ou ímpar (sorteada).
+      for (std::size_t i = next_bit(); i < level.size(); i += 2) {
+        m_levels[h + 1].push_back(std::move(level[i]));
+      }
+      level.clear();
+      if (odd) {
+        level.push_back(std::move(leftover));
+      }
+    }
+  }
+
+  /// Bit pseudoaleatório (xorshift64), suficiente para decidir a paridade da compactação.
+  std::size_t next_bit()
+  {
+    m_rng ^= m_rng << 13;
+    m_rng ^= m_rng >> 7;
+    m_rng ^= m_rng << 17;
+    return static_cast<std::size_t>(m_rng & 1u);
+  }
+
+  std::size_t m_k;
+  Compare m_cmp;
+  std::vector<std::vector<T>> m_levels;  //!< `m_levels[h]`: amostras de peso 2^h.
+  std::uint64_t m_count{ 0 };
+  T m_min{}, m_max{};
+  std::uint64_t m_rng{ 0x9E3779B97F4A7C15ull };
+};
+
+namespace detail {
+
+/// Inverte um comparador: `reverse_compare{ cmp }(a, b) == cmp(b, a)`.
+template <class Compare> struct reverse_compare {
+  Compare cmp;
+  template <class A, class B> bool operator()(const A& a, const B& b) const { return cmp(b, a); }
+};
+
+/**
+ * @brief Seleciona os `k` menores elementos (segundo `cmp`) com um heap limitado a `k` entradas.
+ *
+ * Cada entrada guarda o valor e a posição de origem. O topo do heap é o pior elemento
+ * mantido; um novo elemento só entra se for estritamente melhor que ele, então, entre
+ * equivalentes, os que aparecem primeiro são preferidos (como em uma ordenação estável).
+ *
+ * Quando `Dir != 0` (range contíguo, tipo aritmético, `std::less`/`std::greater`), depois
+ * que o heap enche os elementos são testados contra o limiar (o topo) em blocos
+ * vetoriais, e só as lanes que passam no teste chegam ao heap.
+ *
+ * @return As entradas selecionadas, do melhor para o pior.
+ */
+template <int Dir, class InputIt, class Compare>
+std::vector<std::pair<typename std::iterator_traits<InputIt>::value_type, std::size_t>>
+select_k(InputIt first, InputIt last, std::size_t k, Compare cmp)
+{
+  using T = typename std::iterator_traits<InputIt>::value_type;
+  using entry = std::pair<T, std::size_t>;
+  // `better(a, b)`: a vem antes de b na ordem final. O heap usa `better` como "menor que",
+  // então o topo é a pior entrada mantida.
+  auto better = [&cmp](const entry& a, const entry& b) {
+    return cmp(a.first, b.first) || (!cmp(b.first, a.first) && a.second < b.second);
+  };
+  std::vector<entry> heap;
+  if (k == 0) {
+    return heap;
+  }
+  if constexpr (is_random_access_v<InputIt>) {
+    // `k` pode ser bem maior que o range; nesse caso o resultado é o range inteiro.
+    heap.reserve(std::min(k, static_cast<std::size_t>(std::distance(first, last))));
+  }
+  auto offer = [&](const T& value, std::size_t pos) {
+    if (heap.size() < k) {
+      heap.emplace_back(value, pos);
+      std::push_heap(heap.begin(), heap.end(), better);
+    } else if (cmp(value, heap.front().first)) {
+      std::pop_heap(heap.begin(), heap.end(), better);
+      heap.back() = entry(value, pos);
+      std::push_heap(heap.begin(), heap.end(), better);
+    }
+  };
+
+  std::size_t pos = 0;
+  if constexpr (Dir != 0) {
+    using V = simd::ops<simd_key_t<T>>;
+    using key = simd_key_t<T>;
+    constexpr std::size_t L = V::lanes;
+    const std::size_t n = static_cast<std::size_t>(last - first);
+    if (n == 0) {
+      return heap;  // `to_pointer` desreferencia `first`, que aqui seria `last`.
+    }
+    const T* p = to_pointer(first);
+    // Enche o heap com os primeiros k elementos.
+    for (; pos < n && heap.size() < k; ++pos) {
+      offer(p[pos], pos);
+    }
+    // Filtro vetorial: só as lanes melhores que o limiar atual passam para o heap.
+    for (; pos + L <= n; pos += L) {
+      auto thr = V::set1(static_cast<key>(heap.front().first));
+      auto v = V::load(p + pos);
+      unsigned hits = V::bits(Dir > 0 ? V::lt(v, thr) : V::lt(thr, v));
+      for (std::size_t l = 0; hits != 0; ++l, hits >>= 1) {
+        if (hits & 1u) {
+          offer(p[pos + l], pos + l);
+        }
+      }
+    }
+    for (; pos < n; ++pos) {
+      offer(p[pos], pos);
+    }
+  } else {
+    for (; first != last; ++first, ++pos) {
+      offer(*first, pos);
+    }
+  }
+  std::sort_heap(heap.begin(), heap.end(), better);
+  return heap;
+}
+
+template <class InputIt, class Compare>
+constexpr int select_k_direction()
+{
+  using T = typename std::iterator_traits<InputIt>::value_type;
+  if constexpr (simd::has_ops<T>::value && is_contiguous_iterator<InputIt>::value) {
+    return compare_direction<Compare, T>::value;
+  } else {
+    return 0;
+  }
+}
+
+}  // namespace detail
+
+/**
+ * @brief Copia para @p out os `k` maiores elementos de um range, do maior para o menor.
+ *
+ * Usa um heap limitado a `k` elementos (O(n log k), memória O(k)) em vez de ordenar o range
+ * inteiro. Entre elementos equivalentes, os que aparecem primeiro no range são preferidos,
+ * como nos primeiros `k` de uma ordenação estável decrescente. Para ranges contíguos de
+ * tipos aritméticos com `std::less`/`std::greater`, os elementos que não superam o k-ésimo
+ * atual são descartados em blocos SIMD.
+ *
+ * @tparam InputIt O tipo do iterador de entrada.
+ * @tparam Compare O comparador; deve retornar true se o primeiro for menor que o segundo.
+ * @tparam OutputIt O tipo do iterador de saída.
+ * @param first Um iterador para o primeiro elemento do intervalo.
+ * @param last Um iterador para o último elemento do intervalo (exclusivo).
+ * @param k Quantos elementos selecionar; se o range tiver menos, todos são copiados.
+ * @param cmp O comparador usado para determinar a ordem dos elementos.
+ * @param out O início do destino.
+ * @return O iterador de saída após o último elemento escrito.
+ */
+template <class InputIt, class Compare, class OutputIt>
+OutputIt top_k(InputIt first, InputIt last, std::size_t k, Compare cmp, OutputIt out)
+{
+  constexpr int dir = -detail::select_k_direction<InputIt, Compare>();
+  auto best = detail::select_k<dir>(first, last, k, detail::reverse_compare<Compare>{ cmp });
+  for (auto& e : best) {
+    *out = std::move(e.first);
+    ++out;
+  }
+  return out;
+}
+
+/**
+ * @brief Copia para @p out os `k` menores elementos de um range, do menor para o maior.
+ *
+ * Contraparte de `top_k`: mesmas garantias de custo e de desempate (os primeiros do range
+ * são preferidos), como nos primeiros `k` de uma ordenação estável crescente.
+ *
+ * @tparam InputIt O tipo do iterador de entrada.
+ * @tparam Compare O comparador; deve retornar true se o primeiro for menor que o segundo.
+ * @tparam OutputIt O tipo do iterador de saída.
+ * @param first Um iterador para o primeiro elemento do intervalo.
+ * @param last Um iterador para o último elemento do intervalo (exclusivo).
+ * @param k Quantos elementos selecionar; se o range tiver menos, todos são copiados.
+ * @param cmp O comparador usado para determinar a ordem dos elementos.
+ * @param out O início do destino.
+ * @return O iterador de saída após o último elemento escrito.
+ */
+template <class InputIt, class Compare, class OutputIt>
+OutputIt bottom_k(InputIt first, InputIt last, std::size_t k, Compare cmp, OutputIt out)
+{
+  constexpr int dir = detail::select_k_direction<InputIt, Compare>();
+  auto best = detail::select_k<dir>(first, last, k, cmp);
+  for (auto& e : best) {
+    *out = std::move(e.first);
+    ++out;
+  }
+  return out;
+}
+
+namespace detail {
+
+/**
+ * @brief `minmax` de um segmento curto de um range contíguo, sem desvios condicionais.
+ *
+ * As atualizações são escritas como seleções (`cond ? i : atual`), que o compilador
+ * transforma em `cmov`; em segmentos de poucos elementos isso evita os erros de previsão
+ * de desvio que dominam o custo. Segmentos com pelo menos um vetor usam `minmax_simd`,
+ * com a mesma divisão em blocos de 2^30 elementos, o que custa uma redução horizontal por
+ * segmento; a vetorização é dentro de cada segmento, não entre segmentos.
+ */
+template <int Dir, class T>
+std::pair<std::size_t, std::size_t> segment_minmax(const T* p, std::size_t n)
+{
+  if constexpr (simd::has_ops<T>::value) {
+    if (n >= simd::ops<simd_key_t<T>>::lanes) {
+      return minmax_simd<Dir>(p, n);
+    }
+  }
+  std::size_t imin = 0, imax = 0;
+  for (std::size_t i = 1; i < n; ++i) {
+    const bool lt = Dir > 0 ? p[i] < p[imin] : p[imin] < p[i];
+    const bool ge = Dir > 0 ? !(p[i] < p[imax]) : !(p[imax] < p[i]);
+    imin = lt ? i : imin;
+    imax = ge ? i : imax;
+  }
+  return { imin, imax };
+}
+
+/// Processa os segmentos `[s_begin, s_end)`, escrevendo um par por segmento a partir de `out`.
+template <class RandomIt, class OffsetIt, class OutIt, class Compare>
+OutIt segmented_minmax_range(RandomIt first,
+                             OffsetIt offsets,
+                             std::size_t s_begin,
+                             std::size_t s_end,
+                             OutIt out,
+                             Compare cmp)
+{
+  using T = typename std::iterator_traits<RandomIt>::value_type;
+  constexpr int dir = is_contiguous_iterator<RandomIt>::value && std::is_arithmetic<T>::value
+                        ? compare_direction<Compare, T>::value
+                        : 0;
+  for (std::size_t s = s_begin; s < s_end; ++s) {
+    const std::size_t b = static_cast<std::size_t>(offsets[s]);
+    const std::size_t e = static_cast<std::size_t>(offsets[s + 1]);
+    std::pair<std::size_t, std::size_t> r{ b, b };
+    if (e > b) {
+      if constexpr (dir != 0) {
+        r = segment_minmax<dir>(to_pointer(first) + b, e - b);
+        r.first += b;
+        r.second += b;
+      } else {
+        auto it = graal::minmax(first + b, first + e, cmp);
+        r.first = static_cast<std::size_t>(it.first - first);
+        r.second = static_cast<std::size_t>(it.second - first);
+      }
+    }
+    *out = r;
+    ++out;
+  }
+  return out;
+}
+
+}  // namespace detail
+
+/**
+ * @brief `minmax` de cada segmento de um buffer, descrito por um array de offsets (estilo CSR).
+ *
+ * O segmento `s` é `[first + offsets[s], first + offsets[s + 1])`, então `m + 1` offsets
+ * descrevem `m` segmentos. Para cada segmento escreve em @p d_first o par de índices
+ * (relativos a @p first) do primeiro mínimo e do último máximo; um segmento vazio gera
+ * `(offsets[s], offsets[s])`. Uma única chamada percorre todos os segmentos, e em ranges
+ * contíguos de tipos aritméticos com `std::less`/`std::greater` cada segmento é reduzido
+ * sem desvios: por um loop escalar com seleções (curtos) ou pelo kernel de `minmax`
+ * (longos). Não há vetorização entre segmentos, então em segmentos de poucos elementos o
+ * ganho sobre um loop de `std::minmax_element` por segmento é modesto.
+ *
+ * @tparam RandomIt Iterador de acesso aleatório dos valores.
+ * @tparam OffsetIt Iterador de acesso aleatório dos offsets (inteiros crescentes).
+ * @tparam OutputIt Iterador de saída que aceita `std::pair<std::size_t, std::size_t>`.
+ * @tparam Compare O comparador usado para ordenar os elementos.
+ * @param first Início dos valores.
+ * @param last Fim dos valores; `offsets` não pode ultrapassar `last - first` (verificado
+ *             por `assert`).
+ * @param offsets_first Início dos offsets.
+ * @param offsets_last Fim dos offsets.
+ * @param d_first Início do destino, com espaço para um par por segmento.
+ * @param cmp O comparador usado para determinar a ordem dos elementos.
+ * @return O iterador de saída após o último par escrito.
+ */
+template <class RandomIt, class OffsetIt, class OutputIt, class Compare>
+OutputIt segmented_minmax(RandomIt first,
+                          RandomIt last,
+                          OffsetIt offsets_first,
+                          OffsetIt offsets_last,
+                          OutputIt d_first,
+                          Compare cmp)
+{
+  const auto n_offsets = static_cast<std::size_t>(offsets_last - offsets_first);
+  const std::size_t segments = n_offsets == 0 ? 0 : n_offsets - 1;
+  // Os offsets são crescentes, então basta o último caber no buffer.
+  assert(n_offsets == 0
+         || static_cast<std::size_t>(offsets_first[n_offsets - 1])
+              <= static_cast<std::size_t>(last - first));
+  return detail::segmented_minmax_range(first, offsets_first, 0, segments, d_first, cmp);
+}
+
+/**
+ * @brief Versão de `segmented_minmax` com política de execução.
+ *
+ * Com `execution::par`, os segmentos são divididos em blocos contíguos de segmentos, um por
+ * thread, e cada thread escreve diretamente na sua parte do destino. O resultado é idêntico
+ * ao da versão sequencial. O destino deve ser de acesso aleatório.
+ *
+ * @param policy A política de execução; `grain` conta segmentos.
+ * @return O iterador de saída após o último par escrito.
+ */
+template <class ExecutionPolicy, class RandomIt, class OffsetIt, class RandomOutIt, class Compare>
+detail::enable_if_policy_t<ExecutionPolicy, RandomOutIt> segmented_minmax(ExecutionPolicy&& policy,
+                                                                          RandomIt first,
+                                                                          RandomIt last,
+                                                                          OffsetIt offsets_first,
+                                                                          OffsetIt offsets_last,
+                                                                          RandomOutIt d_first,
+                                                                          Compare cmp)
+{
+  if constexpr (!std::is_same<std::decay_t<ExecutionPolicy>, execution::parallel_policy>::value) {
+    (void)policy;
+    return graal::segmented_minmax(first, last, offsets_first, offsets_last, d_first, cmp);
+  } else {
+    const auto n_offsets = static_cast<std::size_t>(offsets_last - offsets_first);
+    const std::size_t segments = n_offsets == 0 ? 0 : n_offsets - 1;
+    assert(n_offsets == 0
+           || static_cast<std::size_t>(offsets_first[n_offsets - 1])
+                <= static_cast<std::size_t>(last - first));
+    detail::parallel_chunks(policy, segments, [&](std::size_t, std::size_t b, std::size_t e) {
+      detail::segmented_minmax_range(first, offsets_first, b, e, d_first + b, cmp);
+    });
+    return d_first + segments;
+  }
+}
+
+
+namespace detail {
+
+/// Verdadeiro quando `reverse` pode mover os elementos como bytes em blocos SIMD.
+template <class It, class T = typename std::iterator_traits<It>::value_type>
+constexpr bool reverse_simd_enabled = GRAAL_SIMD_LEVEL > 0 && is_contiguous_iterator<It>::value
+                                      && std::is_trivially_copyable<T>::value
+                                      && (sizeof(T) == 1 || sizeof(T) == 2 || sizeof(T) == 4
+                                          || sizeof(T) == 8);
+
+/**
+ * @brief Troca `lo[i]` com `hi[-1 - i]` para `i` em `[0, count)`, com `hi - lo >= 2 * count`.
+ *
+ * A cada passo carrega um registrador do início e outro do fim, inverte a ordem das lanes
+ * de cada um e grava cada um na ponta oposta. Como as duas pontas estão separadas por pelo
+ * menos `2 * count` elementos, os blocos nunca se sobrepõem. O que sobra (menos de um
+ * registrador) é trocado de forma escalar.
+ */
+template <class T> void swap_reversed(T* lo, T* hi, std::size_t count)
+{
+#if GRAAL_SIMD_LEVEL > 0
+  constexpr std::size_t W = sizeof(simd::bytes) / sizeof(T);
+  for (; count >= W; count -= W) {
+    auto a = simd::load_bytes(lo);
+    auto b = simd::load_bytes(hi - W);
+    simd::store_bytes(lo, simd::reverse_lanes<sizeof(T)>(b));
+    simd::store_bytes(hi - W, simd::reverse_lanes<sizeof(T)>(a));
+    lo += W;
+    hi -= W;
+  }
+#endif
+  for (; count > 0; --count) {
+    std::swap(*lo++, *--hi);
+  }
+}
+
+}  // namespace detail
+
+
+/**
+ * @brief Reverte a ordem dos elementos em um intervalo.
+ *
+ * Esta função reverte a ordem dos elementos em um intervalo definido pelos iteradores @p first e @p last.
+ * Em ranges contíguos de tipos trivialmente copiáveis de 1, 2, 4 ou 8 bytes, os elementos
+ * são trocados em blocos SIMD, com as lanes invertidas por shuffles/permutações. Nos demais
+ * casos, basta que o iterador seja bidirecional (ex.: `std::list`).
+ *
+ * @tparam BidirIt O tipo do iterador bidirecional usado para acessar os elementos.
+ * @param first Um iterador para o início do intervalo.
+ * @param last Um iterador para o final do intervalo (após o último elemento).
+ */
+
+template <class BidirIt> void reverse(BidirIt first, BidirIt last) {
+      if constexpr (detail::reverse_simd_enabled<BidirIt>) {
+        // Elementos trivialmente copiáveis em memória contígua: trocas em blocos SIMD.
+        if(first != last){
+          const auto n = static_cast<std::size_t>(last - first);
+          auto lo = detail::to_pointer(first);
+          detail::swap_reversed(lo, lo + n, n / 2);
+        }
+        return;
+      }
+      // Iteradores bidirecionais: basta ++, -- e ==. Para quando as pontas se encontram.
+      while(first != last && first != --last){
+        std::iter_swap(first, last);
+        ++first;
+      }
+}
+
+/**
+ * @brief Reverte um sub-range de uma `std::list` religando os nós, sem mover os elementos.
+ *
+ * Cada nó de `(first, last)` é movido com `splice` para antes do início do trecho já
+ * revertido. O custo é O(n) atualizações de ponteiros, independente do tamanho dos
+ * elementos, e iteradores e referências continuam válidos (apontando para o mesmo elemento).
+ *
+ * @tparam T O tipo dos elementos da lista.
+ * @tparam Alloc O alocador da lista.
+ * @param list A lista que contém o intervalo.
+ * @param first Um iterador para o início do intervalo.
+ * @param last Um iterador para o final do intervalo (após o último elemento).
+ */
+template <class T, class Alloc>
+void reverse(std::list<T, Alloc>& list,
+             typename std::list<T, Alloc>::iterator first,
+             typename std::list<T, Alloc>::iterator last)
+{
+  if (first == last) {
+    return;
+  }
+  auto head = first;  // Início do trecho já revertido.
+  for (auto it = std::next(first); it != last;) {
+    auto next = std::next(it);
+    list.splice(head, list, it);
+    head = it;
+    it = next;
+  }
+}
+
+/**
+ * @brief Reverte uma `std::list` inteira religando os nós, sem mover os elementos.
+ * @param list A lista a ser revertida.
+ */
+template <class T, class Alloc> void reverse(std::list<T, Alloc>& list) { list.reverse(); }
+
+/**
+ * @brief Reverte uma `std::forward_list` inteira religando os nós, sem mover os elementos.
+ * @param list A lista a ser revertida.
+ */
+template <class T, class Alloc> void reverse(std::forward_list<T, Alloc>& list) { list.reverse(); }
+
+/**
+ * @brief Versão de `reverse` com política de execução.
+ *
+ * Com `execution::par` e iteradores de acesso aleatório, os `n / 2` pares de trocas
+ * (`i` com `n - 1 - i`) são divididos em blocos, um por thread. As fronteiras dos blocos
+ * caem em múltiplos de 64 bytes do início do range, para que duas threads não escrevam na
+ * mesma linha de cache; em memória contígua de tipos trivialmente copiáveis, cada thread
+ * usa o kernel SIMD de `reverse`. Funciona com qualquer memória endereçável por ponteiros,
+ * inclusive um arquivo mapeado com `mmap`.
+ *
+ * @tparam ExecutionPolicy `execution::sequenced_policy` ou `execution::parallel_policy`.
+ * @param policy A política de execução.
+ * @param first Um iterador para o início do intervalo.
+ * @param last Um iterador para o final do intervalo (após o último elemento).
+ */
+template <class ExecutionPolicy, class BidirIt>
+detail::enable_if_policy_t<ExecutionPolicy, void> reverse(ExecutionPolicy&& policy,
+                                                          BidirIt first,
+                                                          BidirIt last)
+{
+  using P = std::decay_t<ExecutionPolicy>;
+  if constexpr (!std::is_same<P, execution::parallel_policy>::value
+                || !detail::is_random_access_v<BidirIt>) {
+    (void)policy;
+    graal::reverse(first, last);
+  } else {
+    using T = typename std::iterator_traits<BidirIt>::value_type;
+    const auto n = static_cast<std::size_t>(last - first);
+    const std::size_t pairs = n / 2;
+    if constexpr (detail::reverse_simd_enabled<BidirIt>) {
+      if (n == 0) {
+        return;
+      }
+      T* lo = detail::to_pointer(first);
+      T* hi = lo + n;
+      // Elementos por linha de cache e quantos faltam para `lo` chegar a uma fronteira.
+      constexpr std::size_t line = 64 / sizeof(T);
+      const auto addr = reinterpret_cast<std::uintptr_t>(lo);
+      const std::size_t head = std::min(pairs, (64 - addr % 64) % 64 / sizeof(T));
+      detail::swap_reversed(lo, hi, head);
+      detail::parallel_chunks(
+        policy,
+        pairs - head,
+        [&](std::size_t, std::size_t b, std::size_t e) {
+          detail::swap_reversed(lo + head + b, hi - head - b, e - b);
+        },
+        line);
+    } else {
+      detail::parallel_chunks(policy, pairs, [&](std::size_t, std::size_t b, std::size_t e) {
+        for (std::size_t i = b; i < e; ++i) {
+          std::iter_swap(first + i, first + (n - 1 - i));
+        }
+      });
+    }
+  }
+}
+
+namespace detail {
+
+/// Tamanho do buffer em pilha usado por `rotate` quando o deslocamento é pequeno.
+constexpr std::size_t rotate_buffer_bytes = 256;
+
+/// Rotação por ciclos (gcd): cada elemento é movido uma única vez, bom para elementos grandes.
+template <class RandomIt>
+RandomIt rotate_cycles(RandomIt first, std::size_t k, std::size_t n)
+{
+  std::size_t a = n, b = k;
+  while (b != 0) {
+    std::size_t r = a % b;
+    a = b;
+    b = r;
+  }
+  // `a` agora é gcd(n, k): a quantidade de ciclos independentes.
+  for (std::size_t i = 0; i < a; ++i) {
+    typename std::iterator_traits<RandomIt>::value_type tmp = std::move(first[i]);
+    std::size_t j = i;
+    for (;;) {
+      std::size_t d = j + k >= n ? j + k - n : j + k;
+      if (d == i) {
+        break;
+      }
+      first[j] = std::move(first[d]);
+      j = d;
+    }
+    first[j] = std::move(tmp);
+  }
+  return first + (n - k);
+}
+
+/// Rotação para iteradores bidirecionais: três inversões, com o resultado rastreado na última.
+template <class BidirIt> BidirIt rotate_bidirectional(BidirIt first, BidirIt middle, BidirIt last)
+{
+  graal::reverse(first, middle);
+  graal::reverse(middle, last);
+  while (first != middle && middle != last) {
+    std::iter_swap(first, --last);
+    ++first;
+  }
+  if (first == middle) {
+    graal::reverse(middle, last);
+    return last;
+  }
+  graal::reverse(first, middle);
+  return first;
+}
+
+/// Rotação para iteradores de avanço: trocas de blocos sucessivas (Gries-Mills).
+template <class ForwardIt> ForwardIt rotate_forward(ForwardIt first, ForwardIt middle, ForwardIt last)
+{
+  ForwardIt first2 = middle;
+  do {
+    std::iter_swap(first, first2);
+    ++first;
+    ++first2;
+    if (first == middle) {
+      middle = first2;
+    }
+  } while (first2 != last);
+  ForwardIt ret = first;
+  first2 = middle;
+  while (first2 != last) {
+    std::iter_swap(first, first2);
+    ++first;
+    ++first2;
+    if (first == middle) {
+      middle = first2;
+    } else if (first2 == last) {
+      first2 = middle;
+    }
+  }
+  return ret;
+}
+
+}  // namespace detail
+
+/**
+ * @brief Rotaciona um range para a esquerda, de modo que @p middle passe a ser o primeiro elemento.
+ *
+ * A estratégia depende do iterador e do elemento:
+ * - memória contígua de tipos trivialmente copiáveis com a parte menor em até 256 bytes:
+ *   a parte menor vai para um buffer em pilha e o resto é deslocado com um `memmove`;
+ * - idem, com elementos de 1, 2, 4 ou 8 bytes: três inversões com o `reverse` vetorial;
+ * - demais iteradores de acesso aleatório: ciclos (gcd), movendo cada elemento uma vez;
+ * - iteradores bidirecionais: três inversões; de avanço: trocas de blocos.
+ *
+ * @tparam ForwardIt O tipo do iterador do range.
+ * @param first Um iterador para o início do intervalo.
+ * @param middle O elemento que deve ficar no início.
+ * @param last Um iterador para o final do intervalo (após o último elemento).
+ * @return A nova posição do elemento que estava em @p first, i.e. `first + (last - middle)`.
+ */
+template <class ForwardIt> ForwardIt rotate(ForwardIt first, ForwardIt middle, ForwardIt last)
+{
+  if (first == middle) {
+    return last;
+  }
+  if (middle == last) {
+    return first;
+  }
+  using T = typename std::iterator_traits<ForwardIt>::value_type;
+  using category = typename std::iterator_traits<ForwardIt>::iterator_category;
+  if constexpr (std::is_base_of<std::random_access_iterator_tag, category>::value) {
+    const auto n = static_cast<std::size_t>(last - first);
+    const auto k = static_cast<std::size_t>(middle - first);
+    if constexpr (detail::is_contiguous_iterator<ForwardIt>::value
+                  && std::is_trivially_copyable<T>::value) {
+      T* p = detail::to_pointer(first);
+      const std::size_t small = std::min(k, n - k);
+      if (small * sizeof(T) <= detail::rotate_buffer_bytes) {
+        // Deslocamento pequeno: guarda a parte menor e move o resto de uma vez.
+        unsigned char buf[detail::rotate_buffer_bytes];
+        if (k <= n - k) {
+          std::memcpy(buf, p, k * sizeof(T));
+          std::memmove(p, p + k, (n - k) * sizeof(T));
+          std::memcpy(p + (n - k), buf, k * sizeof(T));
+        } else {
+          std::memcpy(buf, p + k, (n - k) * sizeof(T));
+          std::memmove(p + (n - k), p, k * sizeof(T));
+          std::memcpy(p, buf, (n - k) * sizeof(T));
+        }
+        return first + (n - k);
+      }
+      if constexpr (detail::reverse_simd_enabled<ForwardIt>) {
+        // Três inversões vetoriais: percorre a memória de forma sequencial.
+        graal::reverse(first, middle);
+        graal::reverse(middle, last);
+        graal::reverse(first, last);
+        return first + (n - k);
+      }
+    }
+    return detail::rotate_cycles(first, k, n);
+  } else if constexpr (std::is_base_of<std::bidirectional_iterator_tag, category>::value) {
+    return detail::rotate_bidirectional(first, middle, last);
+  } else {
+    return detail::rotate_forward(first, middle, last);
+  }
+}
+
+/**
+ * @brief Copia um range rotacionado: primeiro `[middle, last)` e depois `[first, middle)`.
+ *
+ * Quando origem e destino são contíguos e do mesmo tipo trivialmente copiável, cada uma
+ * das duas partes é copiada com um único `memcpy`.
+ *
+ * @tparam ForwardIt O tipo do iterador de origem.
+ * @tparam OutputIt O tipo do iterador de destino.
+ * @param first Um iterador para o início do intervalo.
+ * @param middle O elemento que deve ficar no início da cópia.
+ * @param last Um iterador para o final do intervalo (após o último elemento).
+ * @param d_first O início do destino, que não pode se sobrepor à origem.
+ * @return Um iterador para o destino, após o último elemento copiado.
+ */
+template <class ForwardIt, class OutputIt>
+OutputIt rotate_copy(ForwardIt first, ForwardIt middle, ForwardIt last, OutputIt d_first)
+{
+  using T = typename std::iterator_traits<ForwardIt>::value_type;
+  if constexpr (detail::is_contiguous_iterator<ForwardIt>::value
+                && detail::is_contiguous_iterator<OutputIt>::value
+                && std::is_same<T, typename std::iterator_traits<OutputIt>::value_type>::value
+                && std::is_trivially_copyable<T>::value) {
+    const auto n = static_cast<std::size_t>(last - first);
+    const auto k = static_cast<std::size_t>(middle - first);
+    if (n != 0) {
+      const T* src = detail::to_pointer(first);
+      T* dst = detail::to_pointer(d_first);
+      std::memcpy(dst, src + k, (n - k) * sizeof(T));
+      std::memcpy(dst + (n - k), src, k * sizeof(T));
+    }
+    return d_first + n;
+  } else {
+    for (auto it = middle; it != last; ++it, ++d_first) {
+      *d_first = *it;
+    }
+    for (auto it = first; it != middle; ++it, ++d_first) {
+      *d_first = *it;
+    }
+    return d_first;
+  }
+}
+
+namespace detail {
+
+/// Verdadeiro quando `byteswap_*` pode processar o range em blocos SIMD.
+template <class It, class T = typename std::iterator_traits<It>::value_type>
+constexpr bool byteswap_simd_enabled = GRAAL_SIMD_LEVEL > 0 && is_contiguous_iterator<It>::value
+                                       && std::is_trivially_copyable<T>::value
+                                       && (sizeof(T) == 2 || sizeof(T) == 4 || sizeof(T) == 8);
+
+/// Inverte a ordem dos bytes de um valor trivialmente copiável de 1, 2, 4 ou 8 bytes.
+template <class T> T byteswap_value(T value)
+{
+  static_assert(std::is_trivially_copyable<T>::value, "byteswap exige tipo trivialmente copiável");
+  static_assert(sizeof(T) == 1 || sizeof(T) == 2 || sizeof(T) == 4 || sizeof(T) == 8,
+                "byteswap exige elementos de 1, 2, 4 ou 8 bytes");
+  if constexpr (sizeof(T) == 1) {
+    return value;
+  } else {
+    using U = std::conditional_t<sizeof(T) == 2, std::uint16_t,
+                                 std::conditional_t<sizeof(T) == 4, std::uint32_t, std::uint64_t>>;
+    U bits;
+    std::memcpy(&bits, &value, sizeof(T));
+    if constexpr (sizeof(T) == 2) {
+      bits = __builtin_bswap16(bits);
+    } else if constexpr (sizeof(T) == 4) {
+      bits = __builtin_bswap32(bits);
+    } else {
+      bits = __builtin_bswap64(bits);
+    }
+    std::memcpy(&value, &bits, sizeof(T));
+    return value;
+  }
+}
+
+/**
+ * @brief Grava em `dst[i]` o valor de `src[i]` com os bytes invertidos, para `i` em `[0, n)`.
+ *
+ * `src` e `dst` podem ser o mesmo ponteiro (conversão no lugar): cada bloco é lido por
+ * inteiro antes de ser gravado.
+ */
+template <class T> void byteswap_block(const T* src, T* dst, std::size_t n)
+{
+  std::size_t i = 0;
+#if GRAAL_SIMD_LEVEL > 0
+  constexpr std::size_t W = sizeof(simd::bytes) / sizeof(T);
+  for (; i + W <= n; i += W) {
+    simd::store_bytes(dst + i, simd::byteswap_lanes<sizeof(T)>(simd::load_bytes(src + i)));
+  }
+#endif
+  for (; i < n; ++i) {
+    dst[i] = byteswap_value(src[i]);
+  }
+}
+
+}  // namespace detail
+
+/**
+ * @brief Inverte, no lugar, a ordem dos bytes dentro de cada elemento do range.
+ *
+ * Converte entre big-endian e little-endian (ex.: dados de rede). Em ranges contíguos de
+ * elementos de 2, 4 ou 8 bytes, cada registrador SIMD é convertido com um único shuffle
+ * de bytes; nos demais casos a conversão é feita elemento a elemento.
+ *
+ * @tparam ForwardIt O tipo do iterador; o elemento deve ser trivialmente copiável, de 1, 2, 4 ou 8 bytes.
+ * @param first Um iterador para o início do intervalo.
+ * @param last Um iterador para o final do intervalo (após o último elemento).
+ */
+template <class ForwardIt> void byteswap_range(ForwardIt first, ForwardIt last)
+{
+  if constexpr (detail::byteswap_simd_enabled<ForwardIt>) {
+    if (first != last) {
+      auto p = detail::to_pointer(first);
+      detail::byteswap_block(p, p, static_cast<std::size_t>(last - first));
+    }
+  } else {
+    for (; first != last; ++first) {
+      *first = detail::byteswap_value(*first);
+    }
+  }
+}
+
+/**
+ * @brief Copia um range invertendo a ordem dos bytes de cada elemento.
+ *
+ * Funde a cópia e a conversão de endianness em uma única passada. Quando origem e destino
+ * são contíguos e do mesmo tipo, usa o mesmo kernel SIMD de `byteswap_range`.
+ *
+ * @tparam InputIt O tipo do iterador de origem; o elemento deve ser trivialmente copiável, de 1, 2, 4 ou 8 bytes.
+ * @tparam OutputIt O tipo do iterador de destino.
+ * @param first Um iterador para o início do intervalo.
+ * @param last Um iterador para o final do intervalo (após o último elemento).
+ * @param d_first O início do destino, que deve ser o próprio `first` ou não se sobrepor à origem.
+ * @return Um iterador para o destino, após o último elemento gravado.
+ */
+template <class InputIt, class OutputIt>
+OutputIt byteswap_copy(InputIt first, InputIt last, OutputIt d_first)
+{
+  using T = typename std::iterator_traits<InputIt>::value_type;
+  if constexpr (detail::byteswap_simd_enabled<InputIt> && detail::is_contiguous_iterator<OutputIt>::value
+                && std::is_same<T, typename std::iterator_traits<OutputIt>::value_type>::value) {
+    const auto n = static_cast<std::size_t>(last - first);
+    if (n != 0) {
+      detail::byteswap_block(detail::to_pointer(first), detail::to_pointer(d_first), n);
+    }
+    return d_first + n;
+  } else {
+    for (; first != last; ++first, ++d_first) {
+      *d_first = detail::byteswap_value(static_cast<T>(*first));
+    }
+    return d_first;
+  }
+}
+
+
+namespace detail {
+
+/// Verdadeiro quando a cópia de `InputIt` para `OutputIt` pode ser feita com `memmove`.
+template <class InputIt, class OutputIt,
+          class T = typename std::iterator_traits<InputIt>::value_type,
+          class U = typename std::iterator_traits<OutputIt>::value_type>
+constexpr bool memmove_copyable = is_contiguous_iterator<InputIt>::value
+                                  && is_contiguous_iterator<OutputIt>::value
+                                  && std::is_same<T, U>::value && std::is_trivially_copyable<T>::value;
+
+}  // namespace detail
+
+/**
+ * @brief Copia elementos de um intervalo para outro.
+ *
+ * Esta função copia os elementos de um intervalo definido pelos iteradores @p first e @p last
+ * para outro intervalo definido pelo iterador @p d_first. Origem e destino podem ser de
+ * tipos de iteradores diferentes (ex.: `std::vector` para array, ou um `std::back_inserter`).
+ * Quando ambos são contíguos e têm o mesmo tipo de elemento trivialmente copiável, a cópia
+ * é feita com um único `memmove`.
+ *
+ * @tparam InputIt O tipo do iterador de entrada usado para acessar os elementos do intervalo de origem.
+ * @tparam OutputIt O tipo do iterador de saída usado para gravar os elementos no destino.
+ * @param first Um iterador para o início do intervalo de origem.
+ * @param last Um iterador para o final do intervalo de origem (após o último elemento).
+ * @param d_first Um iterador para o início do intervalo de destino.
+ * @return Um iterador apontando para o próximo elemento no intervalo de destino após a cópia.
+ */
+
+template <class InputIt, class OutputIt>
+OutputIt copy(InputIt first, InputIt last, OutputIt d_first) {
+    if constexpr (detail::memmove_copyable<InputIt, OutputIt>) {
+      // Mesmo tipo trivialmente copiável nos dois lados: uma única cópia de bytes.
+      using T = typename std::iterator_traits<InputIt>::value_type;
+      const auto n = static_cast<std::size_t>(last - first);
+      if(n != 0){
+        std::memmove(detail::to_pointer(d_first), detail::to_pointer(first), n * sizeof(T));
+      }
+      return d_first + n;
+    }
+    while(first != last){
+      *d_first = *first;
+      ++first;
+      ++d_first;
+    }
+    return d_first;
+}
+
+/// Marcador que seleciona a cópia com gravações não temporais (ver `copy(streaming_t, ...)`).
+struct streaming_t {
+  explicit streaming_t() = default;
+};
+
+inline constexpr streaming_t streaming{};
+
+namespace detail {
+
+/// Abaixo deste tamanho a cópia não temporal não compensa e `memmove` é usado.
+constexpr std::size_t streaming_min_bytes = std::size_t{ 1 } << 12;
+
+/**
+ * @brief Copia `n` bytes de `src` para `dst` sem trazer as linhas do destino para a cache.
+ *
+ * Os primeiros bytes são copiados normalmente até `dst` ficar alinhado ao registrador
+ * (peeling); o corpo é gravado com stores não temporais, uma linha de 64 bytes por
+ * iteração, e a sobra vai por `memcpy`. Um `sfence` no final garante que as gravações
+ * fiquem visíveis às outras threads na ordem usual. Regiões sobrepostas ou pequenas
+ * usam `memmove`.
+ */
+inline void stream_copy_bytes(unsigned char* dst, const unsigned char* src, std::size_t n)
+{
+#if GRAAL_SIMD_LEVEL > 0
+  const auto d = reinterpret_cast<std::uintptr_t>(dst);
+  const auto s = reinterpret_cast<std::uintptr_t>(src);
+  if (n >= streaming_min_bytes && (d + n <= s || s + n <= d)) {
+    constexpr std::size_t W = sizeof(simd::bytes);
+    constexpr std::size_t R = 64 / W;  // Registradores por linha de cache.
+    const std::size_t head = (W - d % W) % W;
+    std::memcpy(dst, src, head);
+    dst += head;
+    src += head;
+    n -= head;
+    for (; n >= 64; n -= 64, dst += 64, src += 64) {
+      simd::bytes v[R];
+      for (std::size_t r = 0; r < R; ++r) {
+        v[r] = simd::load_bytes(src + r * W);
+      }
+      for (std::size_t r = 0; r < R; ++r) {
+        simd::stream_bytes(dst + r * W, v[r]);
+      }
+    }
+    _mm_sfence();
+    std::memcpy(dst, src, n);
+    return;
+  }
+#endif
+  std::memmove(dst, src, n);
+}
+
+}  // namespace detail
+
+/**
+ * @brief Copia elementos com gravações não temporais, sem poluir a cache com o destino.
+ *
+ * Indicada para cópias muito maiores que a cache de último nível, cujo destino não será
+ * lido logo em seguida: as linhas gravadas vão direto para a memória em vez de expulsar
+ * dados de outras threads. Só tem efeito quando origem e destino são contíguos, do mesmo
+ * tipo trivialmente copiável, sem sobreposição e com pelo menos 4 KiB; nos demais casos
+ * equivale a `graal::copy(first, last, d_first)`.
+ *
+ * @tparam InputIt O tipo do iterador de entrada usado para acessar os elementos do intervalo de origem.
+ * @tparam OutputIt O tipo do iterador de saída usado para gravar os elementos no destino.
+ * @param first Um iterador para o início do intervalo de origem.
+ * @param last Um iterador para o final do intervalo de origem (após o último elemento).
+ * @param d_first Um iterador para o início do intervalo de destino.
+ * @return Um iterador apontando para o próximo elemento no intervalo de destino após a cópia.
+ */
+template <class InputIt, class OutputIt>
+OutputIt copy(streaming_t, InputIt first, InputIt last, OutputIt d_first)
+{
+  if constexpr (detail::memmove_copyable<InputIt, OutputIt>) {
+    using T = typename std::iterator_traits<InputIt>::value_type;
+    const auto n = static_cast<std::size_t>(last - first);
+    if (n != 0) {
+      detail::stream_copy_bytes(reinterpret_cast<unsigned char*>(detail::to_pointer(d_first)),
+                                reinterpret_cast<const unsigned char*>(detail::to_pointer(first)),
+                                n * sizeof(T));
+    }
+    return d_first + n;
+  } else {
+    return graal::copy(first, last, d_first);
+  }
+}
+
+/**
+ * @brief Copia elementos de um intervalo para outro, dividindo o trabalho entre threads.
+ *
+ * Cada thread copia um bloco contíguo e, portanto, é a primeira a escrever nas páginas do
+ * seu trecho do destino. Em sistemas NUMA com política "first touch", as páginas de um
+ * buffer recém-alocado ficam no nó da thread que vai processá-las depois com a mesma
+ * política. Em memória contígua de tipos trivialmente copiáveis, as fronteiras dos blocos
+ * caem em início de página do destino (quando o tamanho do elemento divide 4096) e cada
+ * bloco é copiado com `memcpy`. Com `sequenced_policy`, iteradores que não são de acesso
+ * aleatório ou regiões sobrepostas, equivale a `graal::copy(first, last, d_first)`.
+ *
+ * @tparam ExecutionPolicy `execution::sequenced_policy` ou `execution::parallel_policy`.
+ * @param policy A política de execução.
+ * @param first Um iterador para o início do intervalo de origem.
+ * @param last Um iterador para o final do intervalo de origem (após o último elemento).
+ * @param d_first Um iterador para o início do intervalo de destino.
+ * @return Um iterador apontando para o próximo elemento no intervalo de destino após a cópia.
+ */
+template <class ExecutionPolicy, class InputIt, class OutputIt>
+detail::enable_if_policy_t<ExecutionPolicy, OutputIt> copy(ExecutionPolicy&& policy,
+                                                          InputIt first,
+                                                          InputIt last,
+                                                          OutputIt d_first)
+{
+  using P = std::decay_t<ExecutionPolicy>;
+  if constexpr (!std::is_same<P, execution::parallel_policy>::value
+                || !detail::is_random_access_v<InputIt> || !detail::is_random_access_v<OutputIt>) {
+    (void)policy;
+    return graal::copy(first, last, d_first);
+  } else {
+    const auto n = static_cast<std::size_t>(last - first);
+    if constexpr (detail::memmove_copyable<InputIt, OutputIt>) {
+      using T = typename std::iterator_traits<InputIt>::value_type;
+      if (n == 0) {
+        return d_first;
+      }
+      const T* src = detail::to_pointer(first);
+      T* dst = detail::to_pointer(d_first);
+      const auto d = reinterpret_cast<std::uintptr_t>(dst);
+      const auto s = reinterpret_cast<std::uintptr_t>(src);
+      if (d < s + n * sizeof(T) && s < d + n * sizeof(T)) {
+        return graal::copy(first, last, d_first);
+      }
+      // Elementos até o destino chegar a um início de página; o resto é dividido em páginas.
+      constexpr std::size_t page = 4096;
+      constexpr std::size_t per_page = page / sizeof(T) != 0 ? page / sizeof(T) : 1;
+      const std::size_t head = std::min(n, ((page - d % page) % page + sizeof(T) - 1) / sizeof(T));
+      std::memcpy(dst, src, head * sizeof(T));
+      detail::parallel_chunks(
+        policy,
+        n - head,
+        [&](std::size_t, std::size_t b, std::size_t e) {
+          std::memcpy(dst + head + b, src + head + b, (e - b) * sizeof(T));
+        },
+        per_page);
+    } else {
+      detail::parallel_chunks(policy, n, [&](std::size_t, std::size_t b, std::size_t e) {
+        graal::copy(first + b, first + e, d_first + b);
+      });
+    }
+    return d_first + n;
+  }
+}
+
+/**
+ * @brief Copia elementos de um intervalo para outro, do último para o primeiro.
+ *
+ * O destino termina em @p d_last. Como a cópia anda de trás para a frente, o destino pode
+ * se sobrepor ao final da origem (deslocamento para a direita no mesmo buffer). Quando
+ * ambos são contíguos e têm o mesmo tipo trivialmente copiável, usa um único `memmove`.
+ *
+ * @tparam BidirIt1 O tipo do iterador bidirecional de origem.
+ * @tparam BidirIt2 O tipo do iterador bidirecional de destino.
+ * @param first Um iterador para o início do intervalo de origem.
+ * @param last Um iterador para o final do intervalo de origem (após o último elemento).
+ * @param d_last Um iterador para o final do intervalo de destino (após o último elemento).
+ * @return Um iterador para o primeiro elemento copiado no destino.
+ */
+template <class BidirIt1, class BidirIt2>
+BidirIt2 copy_backward(BidirIt1 first, BidirIt1 last, BidirIt2 d_last)
+{
+  if constexpr (detail::memmove_copyable<BidirIt1, BidirIt2>) {
+    const auto d_first = d_last - (last - first);
+    graal::copy(first, last, d_first);
+    return d_first;
+  }
+  while (first != last) {
+    *--d_last = *--last;
+  }
+  return d_last;
+}
+
+/**
+ * @brief Move elementos de um intervalo para outro.
+ *
+ * Igual a `copy`, mas cada elemento é transferido com `std::move`: tipos como
+ * `std::string` entregam o seu buffer em vez de duplicá-lo, e a origem fica em um estado
+ * válido, porém não especificado. Tipos trivialmente copiáveis em memória contígua usam
+ * `memmove`.
+ *
+ * @tparam InputIt O tipo do iterador de entrada usado para acessar os elementos do intervalo de origem.
+ * @tparam OutputIt O tipo do iterador de saída usado para gravar os elementos no destino.
+ * @param first Um iterador para o início do intervalo de origem.
+ * @param last Um iterador para o final do intervalo de origem (após o último elemento).
+ * @param d_first Um iterador para o início do intervalo de destino.
+ * @return Um iterador apontando para o próximo elemento no intervalo de destino após o último movido.
+ */
+template <class InputIt, class OutputIt>
+OutputIt move(InputIt first, InputIt last, OutputIt d_first)
+{
+  if constexpr (detail::memmove_copyable<InputIt, OutputIt>) {
+    return graal::copy(first, last, d_first);
+  }
+  for (; first != last; ++first, ++d_first) {
+    *d_first = std::move(*first);
+  }
+  return d_first;
+}
+
+/**
+ * @brief Move elementos de um intervalo para outro, do último para o primeiro.
+ *
+ * Combina `copy_backward` e `move`: serve para abrir espaço no meio de um buffer
+ * (deslocar para a direita) sem copiar o conteúdo de cada elemento.
+ *
+ * @tparam BidirIt1 O tipo do iterador bidirecional de origem.
+ * @tparam BidirIt2 O tipo do iterador bidirecional de destino.
+ * @param first Um iterador para o início do intervalo de origem.
+ * @param last Um iterador para o final do intervalo de origem (após o último elemento).
+ * @param d_last Um iterador para o final do intervalo de destino (após o último elemento).
+ * @return Um iterador para o primeiro elemento movido no destino.
+ */
+template <class BidirIt1, class BidirIt2>
+BidirIt2 move_backward(BidirIt1 first, BidirIt1 last, BidirIt2 d_last)
+{
+  if constexpr (detail::memmove_copyable<BidirIt1, BidirIt2>) {
+    return graal::copy_backward(first, last, d_last);
+  }
+  while (first != last) {
+    *--d_last = std::move(*--last);
+  }
+  return d_last;
+}
+
+/**
+ * @brief Copia um intervalo para um destino que pode se sobrepor a ele, em qualquer direção.
+ *
+ * Em memória contígua, compara os endereços: se o destino começa dentro da origem, a cópia
+ * é feita de trás para a frente (`copy_backward`); caso contrário, para a frente. Tipos
+ * trivialmente copiáveis do mesmo tipo vão direto para `memmove`, que já trata os dois
+ * casos. Para iteradores não contíguos não há como detectar a sobreposição e a cópia é
+ * feita para a frente, como em `copy`.
+ *
+ * @tparam InputIt O tipo do iterador de entrada usado para acessar os elementos do intervalo de origem.
+ * @tparam OutputIt O tipo do iterador de saída usado para gravar os elementos no destino.
+ * @param first Um iterador para o início do intervalo de origem.
+ * @param last Um iterador para o final do intervalo de origem (após o último elemento).
+ * @param d_first Um iterador para o início do intervalo de destino.
+ * @return Um iterador apontando para o próximo elemento no intervalo de destino após a cópia.
+ */
+template <class InputIt, class OutputIt>
+OutputIt copy_overlapping(InputIt first, InputIt last, OutputIt d_first)
+{
+  if constexpr (!detail::memmove_copyable<InputIt, OutputIt>
+                && detail::is_contiguous_iterator<InputIt>::value
+                && detail::is_contiguous_iterator<OutputIt>::value) {
+    const auto n = static_cast<std::size_t>(last - first);
+    if (n == 0) {
+      return d_first;
+    }
+    const auto s = reinterpret_cast<std::uintptr_t>(detail::to_pointer(first));
+    const auto d = reinterpret_cast<std::uintptr_t>(detail::to_pointer(d_first));
+    const auto s_end = reinterpret_cast<std::uintptr_t>(detail::to_pointer(first) + n);
+    if (s < d && d < s_end) {
+      // O destino começa dentro da origem: andar para a frente sobrescreveria a origem.
+      graal::copy_backward(first, last, d_first + n);
+      return d_first + n;
+    }
+  }
+  return graal::copy(first, last, d_first);
+}
+
+namespace detail {
+
+/// Distância padrão, em elementos, entre o índice acessado e o índice pré-carregado.
+constexpr std::size_t default_prefetch_distance = 32;
+
+/// Sugere ao processador trazer para a cache a linha de `p`, para leitura ou escrita.
+template <bool Write> inline void prefetch(const void* p)
+{
+  __builtin_prefetch(p, Write ? 1 : 0, 3);
+}
+
+/**
+ * @brief Verdadeiro quando `gather_copy`/`scatter_copy` podem usar instruções de gather/scatter.
+ *
+ * Exige índices inteiros com o mesmo tamanho do elemento (4 ou 8 bytes), pois as instruções
+ * usam um índice por lane. Índices de 32 bits precisam ter sinal: as instruções os
+ * interpretam como `int32_t`.
+ */
+template <class IndexIt, class DataIt,
+          class Index = typename std::iterator_traits<IndexIt>::value_type,
+          class T = typename std::iterator_traits<DataIt>::value_type>
+constexpr bool gather_simd_enabled = GRAAL_SIMD_LEVEL >= 2 && is_contiguous_iterator<IndexIt>::value
+                                     && is_contiguous_iterator<DataIt>::value
+                                     && std::is_integral<Index>::value
+                                     && std::is_trivially_copyable<T>::value
+                                     && sizeof(Index) == sizeof(T)
+                                     && (sizeof(T) == 8 || (sizeof(T) == 4 && std::is_signed<Index>::value));
+
+/// Verdadeiro quando dá para obter o endereço de `src[j]` e pré-carregá-lo.
+template <class IndexIt, class RandomIt>
+constexpr bool prefetch_enabled
+  = is_random_access_v<IndexIt> && is_random_access_v<RandomIt>
+    && std::is_reference<typename std::iterator_traits<RandomIt>::reference>::value;
+
+}  // namespace detail
+
 /**
- * @brief Encontra os elementos mínimo e máximo em um intervalo, usando um comparador personalizado.
- * 
- * Esta função encontra os elementos mínimo e máximo em um intervalo definido pelos iteradores 'first' e 'last',
- * usando um comparador personalizado 'cmp' para determinar a ordem dos elementos.
- * 
- * @tparam Itr O tipo do iterador para o intervalo.
- * @tparam Compare O tipo do comparador para ordenação.
- * @param first Um iterador para o primeiro elemento do intervalo.
- * @param last Um iterador para o último elemento do intervalo (exclusivo).
- * @param cmp O comparador usado para determinar a ordem dos elementos. Deve retornar true se o primeiro elemento for considerado menor do que o segundo.
- * @return Um par de iteradores, o primeiro apontando para o elemento mínimo e o segundo para o elemento máximo.
+ * @brief Copia elementos lidos através de um range de índices: `d_first[i] = src[idx[i]]`.
+ *
+ * Útil para reordenar linhas segundo uma permutação. O acesso a `src` é aleatório e, em
+ * tabelas grandes, dominado por faltas de cache; por isso, enquanto copia a posição `i`, a
+ * função pré-carrega `src[idx[i + prefetch_distance]]`. Uma distância 0 desliga o prefetch.
+ * Com AVX2/AVX-512, índices e elementos contíguos de 4 ou 8 bytes (mesmo tamanho) são
+ * lidos com instruções de gather, um registrador por vez.
+ *
+ * @tparam IndexIt O tipo do iterador dos índices (inteiros).
+ * @tparam RandomIt O tipo do iterador de acesso aleatório da origem.
+ * @tparam OutputIt O tipo do iterador de saída.
+ * @param idx_first Um iterador para o início dos índices.
+ * @param idx_last Um iterador para o final dos índices (após o último elemento).
+ * @param src O início da origem; cada índice deve ser válido em `[src, src + tamanho)`.
+ * @param d_first O início do destino, que não pode se sobrepor à origem.
+ * @param prefetch_distance Quantos elementos à frente pré-carregar.
+ * @return Um iterador para o destino, após o último elemento gravado.
  */
+template <class IndexIt, class RandomIt, class OutputIt>
+OutputIt gather_copy(IndexIt idx_first,
+                     IndexIt idx_last,
+                     RandomIt src,
+                     OutputIt d_first,
+                     std::size_t prefetch_distance = detail::default_prefetch_distance)
+{
+  if constexpr (detail::prefetch_enabled<IndexIt, RandomIt>) {
+    const auto n = static_cast<std::size_t>(idx_last - idx_first);
+    std::size_t i = 0;
+#if GRAAL_SIMD_LEVEL >= 2
+    if constexpr (detail::gather_simd_enabled<IndexIt, RandomIt>
+                  && detail::is_contiguous_iterator<OutputIt>::value
+                  && std::is_same<typename std::iterator_traits<RandomIt>::value_type,
+                                  typename std::iterator_traits<OutputIt>::value_type>::value) {
+      using T = typename std::iterator_traits<RandomIt>::value_type;
+      constexpr std::size_t W = sizeof(detail::simd::bytes) / sizeof(T);
+      if (n >= W) {
+        const auto* idx = detail::to_pointer(idx_first);
+        const T* base = detail::to_pointer(src);
+        T* dst = detail::to_pointer(d_first);
+        for (; i + W <= n; i += W) {
+          if (prefetch_distance != 0) {
+            for (std::size_t j = i + prefetch_distance; j < i + prefetch_distance + W && j < n; ++j) {
+              detail::prefetch<false>(base + idx[j]);
+            }
+          }
+          auto v = detail::simd::gather<sizeof(T)>(base, detail::simd::load_bytes(idx + i));
+          detail::simd::store_bytes(dst + i, v);
+        }
+        d_first += i;
+      }
+    }
+#endif
+    for (; i < n; ++i, ++d_first) {
+      if (prefetch_distance != 0 && i + prefetch_distance < n) {
+        detail::prefetch<false>(std::addressof(src[idx_first[i + prefetch_distance]]));
+      }
+      *d_first = src[idx_first[i]];
+    }
+    return d_first;
+  } else {
+    (void)prefetch_distance;
+    for (; idx_first != idx_last; ++idx_first, ++d_first) {
+      *d_first = src[*idx_first];
+    }
+    return d_first;
+  }
+}
 
-template <typename Itr, typename Compare>
-std::pair<Itr, Itr> minmax(Itr first, Itr last, Compare cmp) {
-   if(first == last){
-    return std::make_pair(first, first);
-   }
-   auto min_it = first;
-   auto max_it = first;
-   for(auto it = first; it != last; ++it){
-    if(cmp(*it, *min_it) || (!cmp(*min_it, *it) && it < min_it )){
-      min_it = it;
+/**
+ * @brief Grava elementos em posições dadas por um range de índices: `dst[idx[i]] = first[i]`.
+ *
+ * Operação inversa de `gather_copy`. Enquanto grava a posição `i`, pré-carrega (para
+ * escrita) `dst[idx[i + prefetch_distance]]`; uma distância 0 desliga o prefetch. Com
+ * AVX-512, índices e elementos contíguos de 4 ou 8 bytes (mesmo tamanho) são gravados com
+ * instruções de scatter. Se um índice se repete, prevalece o último elemento, como no
+ * laço sequencial.
+ *
+ * @tparam InputIt O tipo do iterador dos valores.
+ * @tparam IndexIt O tipo do iterador dos índices (inteiros).
+ * @tparam RandomIt O tipo do iterador de acesso aleatório do destino.
+ * @param first Um iterador para o início dos valores.
+ * @param last Um iterador para o final dos valores (após o último elemento).
+ * @param idx_first O início dos índices, um para cada valor.
+ * @param dst O início do destino, que não pode se sobrepor aos valores nem aos índices.
+ * @param prefetch_distance Quantos elementos à frente pré-carregar.
+ * @return Um iterador para os índices, após o último índice usado.
+ */
+template <class InputIt, class IndexIt, class RandomIt>
+IndexIt scatter_copy(InputIt first,
+                     InputIt last,
+                     IndexIt idx_first,
+                     RandomIt dst,
+                     std::size_t prefetch_distance = detail::default_prefetch_distance)
+{
+  if constexpr (detail::prefetch_enabled<IndexIt, RandomIt> && detail::is_random_access_v<InputIt>) {
+    const auto n = static_cast<std::size_t>(last - first);
+    std::size_t i = 0;
+#if GRAAL_SIMD_LEVEL == 3
+    if constexpr (detail::gather_simd_enabled<IndexIt, RandomIt>
+                  && detail::is_contiguous_iterator<InputIt>::value
+                  && std::is_same<typename std::iterator_traits<RandomIt>::value_type,
+                                  typename std::iterator_traits<InputIt>::value_type>::value) {
+      using T = typename std::iterator_traits<RandomIt>::value_type;
+      constexpr std::size_t W = sizeof(detail::simd::bytes) / sizeof(T);
+      if (n >= W) {
+        const auto* idx = detail::to_pointer(idx_first);
+        const T* values = detail::to_pointer(first);
+        T* base = detail::to_pointer(dst);
+        for (; i + W <= n; i += W) {
+          if (prefetch_distance != 0) {
+            for (std::size_t j = i + prefetch_distance; j < i + prefetch_distance + W && j < n; ++j) {
+              detail::prefetch<true>(base + idx[j]);
+            }
+          }
+          detail::simd::scatter<sizeof(T)>(
+            base, detail::simd::load_bytes(idx + i), detail::simd::load_bytes(values + i));
+        }
+      }
     }
-    if(cmp(*max_it, *it) || (!cmp(*it, *max_it) && it > max_it)){
-      max_it = it;
+#endif
+    for (; i < n; ++i) {
+      if (prefetch_distance != 0 && i + prefetch_distance < n) {
+        detail::prefetch<true>(std::addressof(dst[idx_first[i + prefetch_distance]]));
+      }
+      dst[idx_first[i]] = first[i];
     }
-   }
+    return idx_first + n;
+  } else {
+    (void)prefetch_distance;
+    for (; first != last; ++first, ++idx_first) {
+      dst[*idx_first] = *first;
+    }
+    return idx_first;
+  }
+}
 
-  return std::make_pair(min_it, max_it);
+/// Como `convert_copy` trata valores que não cabem no tipo de destino.
+enum class convert_policy {
+  cast,     //!< `static_cast` (inteiros truncados módulo 2^N; float fora da faixa é UB).
+  saturate  //!< Destinos inteiros são limitados a `[lowest(), max()]`; NaN vira 0.
+};
+
+namespace detail {
+
+/// Inteiro com exatamente `S` bytes e o sinal pedido.
+template <std::size_t S, bool Signed> struct exact_int { using type = void; };
+template <> struct exact_int<1, true> { using type = std::int8_t; };
+template <> struct exact_int<1, false> { using type = std::uint8_t; };
+template <> struct exact_int<2, true> { using type = std::int16_t; };
+template <> struct exact_int<2, false> { using type = std::uint16_t; };
+template <> struct exact_int<4, true> { using type = std::int32_t; };
+template <> struct exact_int<4, false> { using type = std::uint32_t; };
+template <> struct exact_int<8, true> { using type = std::int64_t; };
+template <> struct exact_int<8, false> { using type = std::uint64_t; };
+
+/**
+ * Tipo canônico usado para escolher o kernel de conversão: inteiros viram o `intN_t` /
+ * `uintN_t` de mesmo tamanho e sinal (assim `long` e `long long` compartilham kernels),
+ * `float` e `double` ficam como estão e o resto vira `void` (sem kernel).
+ */
+template <class T, bool = std::is_integral<T>::value && !std::is_same<T, bool>::value>
+struct convert_key {
+  using type = std::conditional_t<std::is_same<T, float>::value || std::is_same<T, double>::value,
+                                  T,
+                                  void>;
+};
+template <class T> struct convert_key<T, true> {
+  using type = typename exact_int<sizeof(T), std::is_signed<T>::value>::type;
+};
+template <class T> using convert_key_t = typename convert_key<std::remove_cv_t<T>>::type;
+
+/// Converte um valor escalar segundo a política (referência para os kernels SIMD).
+template <class To, convert_policy P, class From> To convert_value(From x)
+{
+  if constexpr (P == convert_policy::saturate && std::is_integral<To>::value) {
+    using L = std::numeric_limits<To>;
+    if constexpr (std::is_floating_point<From>::value) {
+      if (x != x) {
+        return To(0);
+      }
+      if (x <= static_cast<From>(L::lowest())) {
+        return L::lowest();
+      }
+      if (x >= static_cast<From>(L::max())) {
+        return L::max();
+      }
+    } else if constexpr (std::is_signed<From>::value && std::is_signed<To>::value) {
+      if (static_cast<std::intmax_t>(x) < static_cast<std::intmax_t>(L::lowest())) {
+        return L::lowest();
+      }
+      if (static_cast<std::intmax_t>(x) > static_cast<std::intmax_t>(L::max())) {
+        return L::max();
+      }
+    } else {
+      if constexpr (std::is_signed<From>::value) {
+        if (x < 0) {
+          return To(0);
+        }
+      }
+      if (static_cast<std::uintmax_t>(x) > static_cast<std::uintmax_t>(L::max())) {
+        return L::max();
+      }
+    }
+  }
+  return static_cast<To>(x);
 }
 
+namespace simd {
 
 /**
- * @brief Reverte a ordem dos elementos em um intervalo.
- *
- * Esta função reverte a ordem dos elementos em um intervalo definido pelos iteradores @p first e @p last.
+ * @brief Kernel de conversão de `From` para `To` (tipos canônicos), `step` elementos por vez.
  *
- * @tparam BidirIt O tipo do iterador bidirecional usado para acessar os elementos.
- * @param first Um iterador para o início do intervalo.
- * @param last Um iterador para o final do intervalo (após o último elemento).
+ * A especialização genérica não tem kernel. As especializações usam AVX2 (também no
+ * nível AVX-512) e produzem exatamente o mesmo resultado de `convert_value`.
  */
+template <class From, class To, convert_policy P> struct convert_kernel {
+  static constexpr bool enabled = false;
+  static constexpr std::size_t step = 1;
+  static void run(const From*, To*) {}
+};
 
-template <class BidirIt> void reverse(BidirIt first, BidirIt last) {
-      while(first < last){
-        --last;
-        if(first != last){
-          std::swap(*first, *last);
-          ++first;
+#if GRAAL_SIMD_LEVEL >= 2
+inline __m128i load_half(const void* p) { return _mm_loadu_si128(static_cast<const __m128i*>(p)); }
+inline __m128i load_quarter(const void* p) { return _mm_loadl_epi64(static_cast<const __m128i*>(p)); }
+inline void store_256(void* p, __m256i v) { _mm256_storeu_si256(static_cast<__m256i*>(p), v); }
+
+/*
+ * Alargamentos de inteiros: todo valor cabe no destino, então a política não importa.
+ */
+template <convert_policy P> struct convert_kernel<std::uint8_t, std::int32_t, P> {
+  static constexpr bool enabled = true;
+  static constexpr std::size_t step = 8;
+  static void run(const std::uint8_t* s, std::int32_t* d)
+  {
+    store_256(d, _mm256_cvtepu8_epi32(load_quarter(s)));
+  }
+};
+template <convert_policy P> struct convert_kernel<std::int16_t, std::int32_t, P> {
+  static constexpr bool enabled = true;
+  static constexpr std::size_t step = 8;
+  static void run(const std::int16_t* s, std::int32_t* d)
+  {
+    store_256(d, _mm256_cvtepi16_epi32(load_half(s)));
+  }
+};
+template <convert_policy P> struct convert_kernel<std::uint16_t, std::int32_t, P> {
+  static constexpr bool enabled = true;
+  static constexpr std::size_t step = 8;
+  static void run(const std::uint16_t* s, std::int32_t* d)
+  {
+    store_256(d, _mm256_cvtepu16_epi32(load_half(s)));
+  }
+};
+template <convert_policy P> struct convert_kernel<std::int32_t, std::int64_t, P> {
+  static constexpr bool enabled = true;
+  static constexpr std::size_t step = 4;
+  static void run(const std::int32_t* s, std::int64_t* d)
+  {
+    store_256(d, _mm256_cvtepi32_epi64(load_half(s)));
+  }
+};
+template <convert_policy P> struct convert_kernel<std::uint32_t, std::uint64_t, P> {
+  static constexpr bool enabled = true;
+  static constexpr std::size_t step = 4;
+  static void run(const std::uint32_t* s, std::uint64_t* d)
+  {
+    store_256(d, _mm256_cvtepu32_epi64(load_half(s)));
+  }
+};
+
+/*
+ * Inteiros para ponto flutuante (exatos até 2^24 em `float`; acima disso, arredondados
+ * como no `static_cast`).
+ */
+template <convert_policy P> struct convert_kernel<std::uint8_t, float, P> {
+  static constexpr bool enabled = true;
+  static constexpr std::size_t step = 8;
+  static void run(const std::uint8_t* s, float* d)
+  {
+    _mm256_storeu_ps(d, _mm256_cvtepi32_ps(_mm256_cvtepu8_epi32(load_quarter(s))));
+  }
+};
+template <convert_policy P> struct convert_kernel<std::int16_t, float, P> {
+  static constexpr bool enabled = true;
+  static constexpr std::size_t step = 8;
+  static void run(const std::int16_t* s, float* d)
+  {
+    _mm256_storeu_ps(d, _mm256_cvtepi32_ps(_mm256_cvtepi16_epi32(load_half(s))));
+  }
+};
+template <convert_policy P> struct convert_kernel<std::int32_t, float, P> {
+  static constexpr bool enabled = true;
+  static constexpr std::size_t step = 8;
+  static void run(const std::int32_t* s, float* d)
+  {
+    __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(s));
+    _mm256_storeu_ps(d, _mm256_cvtepi32_ps(v));
+  }
+};
+template <convert_policy P> struct convert_kernel<std::int32_t, double, P> {
+  static constexpr bool enabled = true;
+  static constexpr std::size_t step = 4;
+  static void run(const std::int32_t* s, double* d)
+  {
+    _mm256_storeu_pd(d, _mm256_cvtepi32_pd(load_half(s)));
+  }
+};
+
+/*
+ * Entre `float` e `double` (destino de ponto flutuante: a política não importa).
+ */
+template <convert_policy P> struct convert_kernel<float, double, P> {
+  static constexpr bool enabled = true;
+  static constexpr std::size_t step = 4;
+  static void run(const float* s, double* d)
+  {
+    _mm256_storeu_pd(d, _mm256_cvtps_pd(_mm_loadu_ps(s)));
+  }
+};
+template <convert_policy P> struct convert_kernel<double, float, P> {
+  static constexpr bool enabled = true;
+  static constexpr std::size_t step = 4;
+  static void run(const double* s, float* d)
+  {
+    _mm_storeu_ps(d, _mm256_cvtpd_ps(_mm256_loadu_pd(s)));
+  }
+};
+
+/*
+ * `float` para `int32_t`, truncando para zero. `cvttps` devolve INT32_MIN para NaN e para
+ * valores fora da faixa; na saturação, os grandes viram INT32_MAX e NaN vira 0.
+ */
+template <convert_policy P> struct convert_kernel<float, std::int32_t, P> {
+  static constexpr bool enabled = true;
+  static constexpr std::size_t step = 8;
+  static void run(const float* s, std::int32_t* d)
+  {
+    __m256 x = _mm256_loadu_ps(s);
+    __m256i r = _mm256_cvttps_epi32(x);
+    if constexpr (P == convert_policy::saturate) {
+      __m256 big = _mm256_cmp_ps(x, _mm256_set1_ps(2147483648.0f), _CMP_GE_OQ);
+      r = _mm256_blendv_epi8(r, _mm256_set1_epi32(std::numeric_limits<std::int32_t>::max()),
+                             _mm256_castps_si256(big));
+      r = _mm256_and_si256(r, _mm256_castps_si256(_mm256_cmp_ps(x, x, _CMP_ORD_Q)));
+    }
+    store_256(d, r);
+  }
+};
+
+/*
+ * Estreitamento `int32_t` -> `int16_t`. `packs` satura com sinal; para o truncamento, os
+ * 16 bits baixos são isolados antes e `packus` os repassa sem alteração. Os dois
+ * empacotam por metade de 128 bits, daí a permutação final.
+ */
+template <convert_policy P> struct convert_kernel<std::int32_t, std::int16_t, P> {
+  static constexpr bool enabled = true;
+  static constexpr std::size_t step = 16;
+  static void run(const std::int32_t* s, std::int16_t* d)
+  {
+    __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(s));
+    __m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(s + 8));
+    __m256i r;
+    if constexpr (P == convert_policy::saturate) {
+      r = _mm256_packs_epi32(a, b);
+    } else {
+      const __m256i low = _mm256_set1_epi32(0xFFFF);
+      r = _mm256_packus_epi32(_mm256_and_si256(a, low), _mm256_and_si256(b, low));
+    }
+    store_256(d, _mm256_permute4x64_epi64(r, 0xD8));
+  }
+};
+
+/*
+ * Estreitamento `uint64_t` -> `uint32_t`. Sem comparação sem sinal de 64 bits no AVX2, o
+ * bit de sinal é invertido antes de `cmpgt`; os estouros viram 0xFFFFFFFF e depois os
+ * 32 bits baixos de cada lane são compactados.
+ */
+template <convert_policy P> struct convert_kernel<std::uint64_t, std::uint32_t, P> {
+  static constexpr bool enabled = true;
+  static constexpr std::size_t step = 4;
+  static void run(const std::uint64_t* s, std::uint32_t* d)
+  {
+    __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(s));
+    if constexpr (P == convert_policy::saturate) {
+      const __m256i sign = _mm256_set1_epi64x(std::numeric_limits<std::int64_t>::min());
+      const __m256i limit = _mm256_xor_si256(_mm256_set1_epi64x(0xFFFFFFFFll), sign);
+      v = _mm256_or_si256(v, _mm256_cmpgt_epi64(_mm256_xor_si256(v, sign), limit));
+    }
+    v = _mm256_permutevar8x32_epi32(v, _mm256_setr_epi32(0, 2, 4, 6, 0, 2, 4, 6));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(d), _mm256_castsi256_si128(v));
+  }
+};
+#endif
+
+}  // namespace simd
+
+}  // namespace detail
+
+/**
+ * @brief Copia um range convertendo cada elemento para `To`, em uma única passada.
+ *
+ * Equivale a `*d_first++ = static_cast<To>(x)` para cada `x`, mas com a política de
+ * estouro escolhida em @p policy (veja `graal::convert_policy`). Quando origem e destino
+ * são contíguos, com `value_type` do destino igual a `To`, as conversões mais comuns usam
+ * kernels AVX2:
+ * - alargamento de inteiros: `uint8`/`int16`/`uint16` -> `int32`, `int32` -> `int64`,
+ *   `uint32` -> `uint64`;
+ * - inteiros para ponto flutuante: `uint8`/`int16`/`int32` -> `float`, `int32` -> `double`;
+ * - `float` <-> `double` e `float` -> `int32`;
+ * - estreitamento: `int32` -> `int16` e `uint64` -> `uint32`.
+ * Os kernels são escolhidos pelo tamanho e sinal do tipo (ex.: `long` usa o de `int64_t`).
+ * As demais combinações, e o final de cada range, usam a conversão escalar.
+ *
+ * @tparam To O tipo aritmético de destino.
+ * @tparam InputIt O tipo do iterador de entrada, com `value_type` aritmético.
+ * @tparam OutputIt O tipo do iterador de saída.
+ * @param first Um iterador para o início do intervalo de origem.
+ * @param last Um iterador para o final do intervalo de origem (após o último elemento).
+ * @param d_first O início do destino, que não pode se sobrepor à origem.
+ * @param policy Como tratar valores que não cabem em `To`.
+ * @return Um iterador para o destino, após o último elemento gravado.
+ */
+template <class To, class InputIt, class OutputIt>
+OutputIt convert_copy(InputIt first,
+                      InputIt last,
+                      OutputIt d_first,
+                      convert_policy policy = convert_policy::cast)
+{
+  using From = typename std::iterator_traits<InputIt>::value_type;
+  static_assert(std::is_arithmetic<From>::value && std::is_arithmetic<To>::value,
+                "convert_copy exige tipos aritméticos");
+  auto convert = [&](auto tag) {
+    constexpr convert_policy P = decltype(tag)::value;
+    using SrcKey = detail::convert_key_t<From>;
+    using DstKey = detail::convert_key_t<To>;
+    using kernel = detail::simd::convert_kernel<SrcKey, DstKey, P>;
+    if constexpr (kernel::enabled && detail::is_contiguous_iterator<InputIt>::value
+                  && detail::is_contiguous_iterator<OutputIt>::value
+                  && std::is_same<typename std::iterator_traits<OutputIt>::value_type, To>::value) {
+      const auto n = static_cast<std::size_t>(last - first);
+      std::size_t i = 0;
+      if (n >= kernel::step) {
+        const auto* s = reinterpret_cast<const SrcKey*>(detail::to_pointer(first));
+        auto* d = reinterpret_cast<DstKey*>(detail::to_pointer(d_first));
+        for (; i + kernel::step <= n; i += kernel::step) {
+          kernel::run(s + i, d + i);
         }
       }
+      first += i;
+      d_first += i;
+    }
+    for (; first != last; ++first, ++d_first) {
+      *d_first = detail::convert_value<To, P>(static_cast<From>(*first));
+    }
+    return d_first;
+  };
+  if (policy == convert_policy::saturate) {
+    return convert(std::integral_constant<convert_policy, convert_policy::saturate>{});
+  }
+  return convert(std::integral_constant<convert_policy, convert_policy::cast>{});
 }
 
+namespace detail {
+
+/// Operadores de comparação aceitos nas expressões de predicado.
+enum class cmp_op { lt, le, gt, ge, eq, ne };
+
+/// Tipo do marcador `graal::_1`, que representa o elemento testado.
+struct placeholder {};
+
+/// Indica se `E` é uma expressão de predicado montada a partir de `graal::_1`.
+template <class E> struct is_pred_expr : std::false_type {};
 
 /**
- * @brief Copia elementos de um intervalo para outro.
+ * @brief Comparação do elemento com uma constante: `_1 Op value`.
  *
- * Esta função copia os elementos de um intervalo definido pelos iteradores @p first e @p last
- * para outro intervalo definido pelo iterador @p d_first.
+ * Só é vetorizável quando a comparação escalar acontece no próprio tipo do elemento
+ * (`common_type_t<T, C> == T`), pois então comparar em SIMD com `T(value)` dá o mesmo
+ * resultado. Ex.: `_1 > 5` sobre `double` é vetorizável; `_1 > 5.5` sobre `int` não é, e
+ * fica escalar.
+ */
+template <cmp_op Op, class C> struct cmp_expr {
+  C value;
+
+  template <class X> constexpr bool operator()(const X& x) const
+  {
+    if constexpr (Op == cmp_op::lt) {
+      return x < value;
+    } else if constexpr (Op == cmp_op::le) {
+      return x <= value;
+    } else if constexpr (Op == cmp_op::gt) {
+      return x > value;
+    } else if constexpr (Op == cmp_op::ge) {
+      return x >= value;
+    } else if constexpr (Op == cmp_op::eq) {
+      return x == value;
+    } else {
+      return x != value;
+    }
+  }
+
+  template <class T>
+  static constexpr bool vectorizable = std::is_same<std::common_type_t<T, C>, T>::value;
+
+  /// Avalia a expressão nas lanes de `x` com `simd::ops<K>`; devolve um bit por lane.
+  template <class K> unsigned simd_bits(const typename simd::ops<K>::reg& x) const
+  {
+    using O = simd::ops<K>;
+    const auto c = O::set1(static_cast<K>(value));
+    if constexpr (Op == cmp_op::lt) {
+      return O::bits(O::lt(x, c));
+    } else if constexpr (Op == cmp_op::le) {
+      return O::bits(O::le(x, c));
+    } else if constexpr (Op == cmp_op::gt) {
+      return O::bits(O::lt(c, x));
+    } else if constexpr (Op == cmp_op::ge) {
+      return O::bits(O::le(c, x));
+    } else {
+      // Igualdade como `x <= c && c <= x`: falsa para NaN, como no escalar.
+      const unsigned eq = O::bits(O::le(x, c)) & O::bits(O::le(c, x));
+      return Op == cmp_op::eq ? eq : ~eq & ((1u << O::lanes) - 1);
+    }
+  }
+};
+
+/// Conjunção `L && R` (com curto-circuito na avaliação escalar).
+template <class L, class R> struct and_expr {
+  L lhs;
+  R rhs;
+  template <class X> constexpr bool operator()(const X& x) const { return lhs(x) && rhs(x); }
+  template <class T>
+  static constexpr bool vectorizable = L::template vectorizable<T> && R::template vectorizable<T>;
+  template <class K> unsigned simd_bits(const typename simd::ops<K>::reg& x) const
+  {
+    return lhs.template simd_bits<K>(x) & rhs.template simd_bits<K>(x);
+  }
+};
+
+/// Disjunção `L || R` (com curto-circuito na avaliação escalar).
+template <class L, class R> struct or_expr {
+  L lhs;
+  R rhs;
+  template <class X> constexpr bool operator()(const X& x) const { return lhs(x) || rhs(x); }
+  template <class T>
+  static constexpr bool vectorizable = L::template vectorizable<T> && R::template vectorizable<T>;
+  template <class K> unsigned simd_bits(const typename simd::ops<K>::reg& x) const
+  {
+    return lhs.template simd_bits<K>(x) | rhs.template simd_bits<K>(x);
+  }
+};
+
+/// Negação `!E`.
+template <class E> struct not_expr {
+  E expr;
+  template <class X> constexpr bool operator()(const X& x) const { return !expr(x); }
+  template <class T> static constexpr bool vectorizable = E::template vectorizable<T>;
+  template <class K> unsigned simd_bits(const typename simd::ops<K>::reg& x) const
+  {
+    return ~expr.template simd_bits<K>(x) & ((1u << simd::ops<K>::lanes) - 1);
+  }
+};
+
+template <cmp_op Op, class C> struct is_pred_expr<cmp_expr<Op, C>> : std::true_type {};
+template <class L, class R> struct is_pred_expr<and_expr<L, R>> : std::true_type {};
+template <class L, class R> struct is_pred_expr<or_expr<L, R>> : std::true_type {};
+template <class E> struct is_pred_expr<not_expr<E>> : std::true_type {};
+
+template <class C>
+using enable_if_constant_t = std::enable_if_t<std::is_arithmetic<C>::value, int>;
+template <class L, class R>
+using enable_if_exprs_t = std::enable_if_t<is_pred_expr<L>::value && is_pred_expr<R>::value, int>;
+
+/*
+ * Operadores que montam as expressões. Ficam em `detail`, junto dos tipos, para serem
+ * encontrados por ADL. Com a constante à esquerda, o operador é espelhado (`5 < _1` vira
+ * `_1 > 5`).
+ */
+template <class C, enable_if_constant_t<C> = 0> constexpr auto operator<(placeholder, C c)
+{
+  return cmp_expr<cmp_op::lt, C>{ c };
+}
+template <class C, enable_if_constant_t<C> = 0> constexpr auto operator<=(placeholder, C c)
+{
+  return cmp_expr<cmp_op::le, C>{ c };
+}
+template <class C, enable_if_constant_t<C> = 0> constexpr auto operator>(placeholder, C c)
+{
+  return cmp_expr<cmp_op::gt, C>{ c };
+}
+template <class C, enable_if_constant_t<C> = 0> constexpr auto operator>=(placeholder, C c)
+{
+  return cmp_expr<cmp_op::ge, C>{ c };
+}
+template <class C, enable_if_constant_t<C> = 0> constexpr auto operator==(placeholder, C c)
+{
+  return cmp_expr<cmp_op::eq, C>{ c };
+}
+template <class C, enable_if_constant_t<C> = 0> constexpr auto operator!=(placeholder, C c)
+{
+  return cmp_expr<cmp_op::ne, C>{ c };
+}
+template <class C, enable_if_constant_t<C> = 0> constexpr auto operator<(C c, placeholder)
+{
+  return cmp_expr<cmp_op::gt, C>{ c };
+}
+template <class C, enable_if_constant_t<C> = 0> constexpr auto operator<=(C c, placeholder)
+{
+  return cmp_expr<cmp_op::ge, C>{ c };
+}
+template <class C, enable_if_constant_t<C> = 0> constexpr auto operator>(C c, placeholder)
+{
+  return cmp_expr<cmp_op::lt, C>{ c };
+}
+template <class C, enable_if_constant_t<C> = 0> constexpr auto operator>=(C c, placeholder)
+{
+  return cmp_expr<cmp_op::le, C>{ c };
+}
+template <class C, enable_if_constant_t<C> = 0> constexpr auto operator==(C c, placeholder)
+{
+  return cmp_expr<cmp_op::eq, C>{ c };
+}
+template <class C, enable_if_constant_t<C> = 0> constexpr auto operator!=(C c, placeholder)
+{
+  return cmp_expr<cmp_op::ne, C>{ c };
+}
+template <class L, class R, enable_if_exprs_t<L, R> = 0> constexpr auto operator&&(L l, R r)
+{
+  return and_expr<L, R>{ l, r };
+}
+template <class L, class R, enable_if_exprs_t<L, R> = 0> constexpr auto operator||(L l, R r)
+{
+  return or_expr<L, R>{ l, r };
+}
+template <class E, std::enable_if_t<is_pred_expr<E>::value, int> = 0> constexpr auto operator!(E e)
+{
+  return not_expr<E>{ e };
+}
+
+/// Verdadeiro quando o predicado `P` pode ser avaliado em SIMD sobre o range `It`.
+template <class It, class P, class T = typename std::iterator_traits<It>::value_type, class = void>
+struct expr_simd_enabled : std::false_type {};
+template <class It, class P, class T>
+struct expr_simd_enabled<It, P, T, std::enable_if_t<is_pred_expr<P>::value>>
+    : std::bool_constant<is_contiguous_iterator<It>::value && simd::has_ops<T>::value
+                         && P::template vectorizable<T>> {};
+
+/**
+ * @brief Índice do primeiro elemento de `p[0, n)` em que a expressão vale `!Negate`, ou `n`.
+ *
+ * Avalia a expressão um registrador por vez e para no primeiro bloco com alguma lane
+ * selecionada; o que sobra (menos de um registrador) é avaliado escalarmente.
+ */
+template <bool Negate, class T, class Expr>
+std::size_t expr_find(const T* p, std::size_t n, const Expr& e)
+{
+  using K = simd_key_t<T>;
+  using O = simd::ops<K>;
+  constexpr unsigned full = (1u << O::lanes) - 1;
+  std::size_t i = 0;
+  for (; i + O::lanes <= n; i += O::lanes) {
+    unsigned b = e.template simd_bits<K>(O::load(p + i));
+    if (Negate) {
+      b = ~b & full;
+    }
+    if (b != 0) {
+      return i + static_cast<std::size_t>(__builtin_ctz(b));
+    }
+  }
+  for (; i < n; ++i) {
+    if (e(p[i]) != Negate) {
+      return i;
+    }
+  }
+  return n;
+}
+
+}  // namespace detail
+
+/**
+ * @brief Marcador do elemento testado em expressões de predicado.
+ *
+ * Comparações de `_1` com constantes aritméticas, combinadas com `&&`, `||` e `!`, formam
+ * predicados comuns (ex.: `graal::_1 > 5 && graal::_1 < 100`) que podem ser chamados como
+ * qualquer função. Em ranges contíguos de `int32_t`, `int64_t`, `float` ou `double`,
+ * `find_if`, `all_of`, `any_of`, `none_of` e `copy_if` reconhecem essas expressões e as
+ * avaliam em blocos SIMD.
+ */
+inline constexpr detail::placeholder _1{};
+
+namespace detail {
+
+/// Verdadeiro quando `copy_if` pode gravar os selecionados com `compress_store`.
+template <class InputIt, class OutputIt, class T = typename std::iterator_traits<InputIt>::value_type>
+constexpr bool compress_simd_enabled = GRAAL_SIMD_LEVEL >= 2 && memmove_copyable<InputIt, OutputIt>
+                                       && std::is_arithmetic<T>::value
+                                       && (sizeof(T) == 4 || sizeof(T) == 8);
+
+}  // namespace detail
+
+/**
+ * @brief Copia os elementos que satisfazem um predicado, preservando a ordem.
  *
- * @tparam InputIt O tipo do iterador de entrada usado para acessar os elementos do intervalo de origem e destino.
+ * Em ranges contíguos de tipos aritméticos de 4 ou 8 bytes (origem e destino do mesmo
+ * tipo), o predicado é avaliado para um registrador inteiro de elementos e os resultados
+ * formam uma máscara; os selecionados são então gravados de uma vez com `vpcompress`
+ * (AVX-512) ou com um shuffle tabelado (AVX2). Assim não há um desvio por elemento que o
+ * processador precise prever. O predicado é chamado exatamente uma vez por elemento, em
+ * ordem; se for uma expressão com `graal::_1`, a própria avaliação também é vetorial.
+ *
+ * @tparam InputIt O tipo do iterador de entrada usado para acessar os elementos do intervalo de origem.
+ * @tparam OutputIt O tipo do iterador de saída usado para gravar os elementos no destino.
+ * @tparam UnaryPredicate O tipo do predicado unário que determina se um elemento é copiado.
  * @param first Um iterador para o início do intervalo de origem.
  * @param last Um iterador para o final do intervalo de origem (após o último elemento).
- * @param d_first Um iterador para o início do intervalo de destino.
- * @return Um iterador apontando para o próximo elemento no intervalo de destino após a cópia.
+ * @param d_first O início do destino, que não pode se sobrepor à origem.
+ * @param pred O predicado unário que seleciona os elementos copiados.
+ * @return Um iterador para o destino, após o último elemento copiado.
  */
-
-template <class InputIt> InputIt copy(InputIt first, InputIt last, InputIt d_first) {
-    while(first != last){
+template <class InputIt, class OutputIt, class UnaryPredicate>
+OutputIt copy_if(InputIt first, InputIt last, OutputIt d_first, UnaryPredicate pred)
+{
+#if GRAAL_SIMD_LEVEL >= 2
+  if constexpr (detail::compress_simd_enabled<InputIt, OutputIt>) {
+    using T = typename std::iterator_traits<InputIt>::value_type;
+    constexpr std::size_t W = sizeof(detail::simd::bytes) / sizeof(T);
+    const auto n = static_cast<std::size_t>(last - first);
+    if (n >= W) {
+      const T* src = detail::to_pointer(first);
+      std::size_t i = 0;
+      for (; i + W <= n; i += W) {
+        unsigned bits = 0;
+        if constexpr (detail::expr_simd_enabled<InputIt, UnaryPredicate>::value) {
+          // Expressão com `graal::_1`: o predicado também é avaliado em SIMD.
+          using K = detail::simd_key_t<T>;
+          bits = pred.template simd_bits<K>(detail::simd::ops<K>::load(src + i));
+        } else {
+          for (std::size_t j = 0; j < W; ++j) {
+            bits |= static_cast<unsigned>(static_cast<bool>(pred(src[i + j]))) << j;
+          }
+        }
+        if (bits != 0) {
+          // O destino só é desreferenciado quando há algo a gravar.
+          d_first += detail::simd::compress_store<sizeof(T)>(
+            detail::to_pointer(d_first), detail::simd::load_bytes(src + i), bits);
+        }
+      }
+      first += i;
+    }
+  }
+#endif
+  for (; first != last; ++first) {
+    if (pred(*first)) {
       *d_first = *first;
-      ++first;
       ++d_first;
     }
-    return d_first;
+  }
+  return d_first;
+}
+
+
+namespace detail {
+
+/// Verdadeiro quando `find`/`find_not` podem comparar os elementos como inteiros em blocos.
+template <class It, class V, class T = typename std::iterator_traits<It>::value_type>
+constexpr bool find_value_enabled = is_contiguous_iterator<It>::value && std::is_integral<T>::value
+                                    && !std::is_same<T, bool>::value && std::is_integral<V>::value
+                                    && (sizeof(T) == 1 || sizeof(T) == 2 || sizeof(T) == 4
+                                        || sizeof(T) == 8);
+
+/**
+ * @brief Índice do primeiro elemento de `p[0, n)` igual (ou, com `!Equal`, diferente) a `v`.
+ *
+ * Com `Equal` e elementos de 1 byte usa `memchr`; sem SIMD e com elementos do tamanho de
+ * `wchar_t`, `wmemchr`. Nos demais casos percorre escalarmente até `p` ficar alinhado ao
+ * registrador e então compara um registrador por vez (comparação + movemask), com as
+ * sobras no final tratadas escalarmente.
+ *
+ * @return O índice encontrado, ou `n`.
+ */
+template <bool Equal, class T> std::size_t find_value(const T* p, std::size_t n, T v)
+{
+  if constexpr (Equal && sizeof(T) == 1) {
+    const void* hit = std::memchr(p, static_cast<unsigned char>(v), n);
+    return hit ? static_cast<std::size_t>(static_cast<const T*>(hit) - p) : n;
+  }
+#if GRAAL_SIMD_LEVEL == 0
+  if constexpr (Equal && sizeof(T) == sizeof(wchar_t)) {
+    wchar_t w;
+    std::memcpy(&w, &v, sizeof(T));
+    const wchar_t* hit = std::wmemchr(reinterpret_cast<const wchar_t*>(p), w, n);
+    return hit ? static_cast<std::size_t>(hit - reinterpret_cast<const wchar_t*>(p)) : n;
+  }
+#endif
+  std::size_t i = 0;
+#if GRAAL_SIMD_LEVEL > 0
+  constexpr std::size_t R = sizeof(simd::bytes);
+  constexpr std::size_t W = R / sizeof(T);
+  constexpr std::size_t lane_bits = simd::eq_bits_per_lane<sizeof(T)>;
+  constexpr std::uint64_t full = W * lane_bits == 64 ? ~std::uint64_t{ 0 }
+                                                     : (std::uint64_t{ 1 } << (W * lane_bits)) - 1;
+  if (n >= 2 * W) {
+    // Prefixo escalar até o início de um registrador alinhado.
+    const auto addr = reinterpret_cast<std::uintptr_t>(p);
+    const std::size_t head = addr % sizeof(T) == 0 ? (R - addr % R) % R / sizeof(T) : 0;
+    for (; i < head; ++i) {
+      if ((p[i] == v) == Equal) {
+        return i;
+      }
+    }
+    std::uint64_t bits;
+    std::memcpy(&bits, &v, sizeof(T));
+    const simd::bytes needle = simd::splat<sizeof(T)>(bits);
+    for (; i + W <= n; i += W) {
+      std::uint64_t hit = simd::eq_bits<sizeof(T)>(simd::load_bytes(p + i), needle);
+      if (!Equal) {
+        hit = ~hit & full;
+      }
+      if (hit != 0) {
+        return i + static_cast<std::size_t>(__builtin_ctzll(hit)) / lane_bits;
+      }
+    }
+  }
+#endif
+  for (; i < n; ++i) {
+    if ((p[i] == v) == Equal) {
+      return i;
+    }
+  }
+  return n;
+}
+
+/// Implementação comum de `find` (`Equal`) e `find_not` (`!Equal`).
+template <bool Equal, class InputIt, class V>
+InputIt find_dispatch(InputIt first, InputIt last, const V& value)
+{
+  if constexpr (find_value_enabled<InputIt, V>) {
+    using T = typename std::iterator_traits<InputIt>::value_type;
+    if (first == last) {
+      return last;
+    }
+    // `x == value` é avaliado no tipo comum; como `T` cabe nele sem perdas, só `T(value)`
+    // pode ser igual a `value`. Se nem ele é, nenhum elemento é.
+    using C = std::common_type_t<T, V>;
+    const T v = static_cast<T>(value);
+    if (static_cast<C>(v) != static_cast<C>(value)) {
+      return Equal ? last : first;
+    }
+    const auto n = static_cast<std::size_t>(last - first);
+    return first + find_value<Equal>(detail::to_pointer(first), n, v);
+  } else {
+    for (; first != last; ++first) {
+      if ((*first == value) == Equal) {
+        return first;
+      }
+    }
+    return last;
+  }
+}
+
+}  // namespace detail
+
+/**
+ * @brief Encontra o primeiro elemento de um intervalo igual a um valor.
+ *
+ * Em ranges contíguos de inteiros de 1, 2, 4 ou 8 bytes, a busca usa `memchr` (1 byte) ou
+ * compara um registrador SIMD inteiro por vez, a partir de endereços alinhados.
+ *
+ * @tparam InputIt O tipo do iterador de entrada usado para acessar os elementos do intervalo.
+ * @tparam T O tipo do valor procurado.
+ * @param first Um iterador para o início do intervalo.
+ * @param last Um iterador para o final do intervalo (após o último elemento).
+ * @param value O valor procurado, comparado com `==`.
+ * @return Um iterador para o primeiro elemento igual a @p value, ou @p last se não houver.
+ */
+template <class InputIt, class T> InputIt find(InputIt first, InputIt last, const T& value)
+{
+  return detail::find_dispatch<true>(first, last, value);
 }
 
+/**
+ * @brief Encontra o primeiro elemento de um intervalo diferente de um valor.
+ *
+ * Útil para pular sequências de um mesmo valor (ex.: espaços ou zeros). Usa os mesmos
+ * kernels SIMD de `find`.
+ *
+ * @tparam InputIt O tipo do iterador de entrada usado para acessar os elementos do intervalo.
+ * @tparam T O tipo do valor a ser pulado.
+ * @param first Um iterador para o início do intervalo.
+ * @param last Um iterador para o final do intervalo (após o último elemento).
+ * @param value O valor a ser pulado, comparado com `==`.
+ * @return Um iterador para o primeiro elemento diferente de @p value, ou @p last se não houver.
+ */
+template <class InputIt, class T> InputIt find_not(InputIt first, InputIt last, const T& value)
+{
+  return detail::find_dispatch<false>(first, last, value);
+}
 
 /**
  * @brief Encontra o primeiro elemento em um intervalo que satisfaz um predicado.
@@ -95,6 +4097,8 @@ template <class InputIt> InputIt copy(InputIt first, InputIt last, InputIt d_fir
  * Esta função percorre o intervalo definido pelos iteradores @p first e @p last, e retorna
  * um iterador para o primeiro elemento que satisfaz o predicado especificado pela função
  * @p p.
+ * Se @p p for uma expressão com `graal::_1` e o range for contíguo de `int32_t`, `int64_t`,
+ * `float` ou `double`, os elementos são testados em blocos SIMD.
  *
  * @tparam InputIt O tipo do iterador de entrada usado para acessar os elementos do intervalo.
  * @tparam UnaryPredicate O tipo do predicado unário que determina se um elemento satisfaz a condição.
@@ -106,6 +4110,13 @@ template <class InputIt> InputIt copy(InputIt first, InputIt last, InputIt d_fir
 
 template <class InputIt, class UnaryPredicate>
 InputIt find_if(InputIt first, InputIt last, UnaryPredicate p) {
+  if constexpr (detail::expr_simd_enabled<InputIt, UnaryPredicate>::value) {
+    if(first == last){
+      return last;
+    }
+    const auto n = static_cast<std::size_t>(last - first);
+    return first + detail::expr_find<false>(detail::to_pointer(first), n, p);
+  }
   while(first != last){
     if(p(*first)){
       return first;
@@ -115,11 +4126,78 @@ InputIt find_if(InputIt first, InputIt last, UnaryPredicate p) {
   return last;
 }
 
+namespace detail {
+
+/// Elementos examinados por uma thread de `find_if` paralelo entre consultas ao cancelamento.
+constexpr std::size_t find_cancel_block = std::size_t{ 1 } << 12;
+
+/// Reduz `target` para `value` se este for menor (mínimo atômico).
+inline void atomic_min(std::atomic<std::size_t>& target, std::size_t value)
+{
+  std::size_t current = target.load(std::memory_order_relaxed);
+  while (value < current
+         && !target.compare_exchange_weak(current, value, std::memory_order_relaxed)) {
+  }
+}
+
+}  // namespace detail
+
+/**
+ * @brief Encontra o primeiro elemento que satisfaz um predicado, dividindo a busca entre threads.
+ *
+ * Com `execution::par` e iteradores de acesso aleatório, cada thread percorre o seu bloco
+ * em trechos de 4096 elementos (com o `find_if` sequencial, inclusive o caminho SIMD das
+ * expressões com `graal::_1`). Ao encontrar um elemento, a thread publica o seu índice com
+ * um mínimo atômico; antes de cada trecho, as threads consultam esse índice e param se já
+ * há um acerto antes da posição em que estão. O resultado é sempre o mesmo da versão
+ * sequencial: o primeiro elemento, na ordem do range, que satisfaz o predicado. O
+ * predicado pode ser chamado para elementos posteriores a esse.
+ *
+ * @tparam ExecutionPolicy `execution::sequenced_policy` ou `execution::parallel_policy`.
+ * @param policy A política de execução.
+ * @param first Um iterador para o início do intervalo.
+ * @param last Um iterador para o final do intervalo (após o último elemento).
+ * @param p O predicado unário que define a condição que o elemento deve satisfazer.
+ * @return Um iterador para o primeiro elemento que satisfaz o predicado, ou @p last se nenhum elemento for encontrado.
+ */
+template <class ExecutionPolicy, class InputIt, class UnaryPredicate>
+detail::enable_if_policy_t<ExecutionPolicy, InputIt> find_if(ExecutionPolicy&& policy,
+                                                             InputIt first,
+                                                             InputIt last,
+                                                             UnaryPredicate p)
+{
+  using P = std::decay_t<ExecutionPolicy>;
+  if constexpr (!std::is_same<P, execution::parallel_policy>::value
+                || !detail::is_random_access_v<InputIt>) {
+    (void)policy;
+    return graal::find_if(first, last, p);
+  } else {
+    const auto n = static_cast<std::size_t>(last - first);
+    std::atomic<std::size_t> found{ n };
+    detail::parallel_chunks(policy, n, [&](std::size_t, std::size_t b, std::size_t e) {
+      for (std::size_t i = b; i < e; i += detail::find_cancel_block) {
+        if (found.load(std::memory_order_relaxed) < i) {
+          return;  // Já há um acerto antes deste ponto: o resto do bloco não importa.
+        }
+        const std::size_t end = std::min(e, i + detail::find_cancel_block);
+        auto hit = graal::find_if(first + i, first + end, p);
+        if (hit != first + end) {
+          detail::atomic_min(found, static_cast<std::size_t>(hit - first));
+          return;
+        }
+      }
+    });
+    return first + found.load();
+  }
+}
+
 /**
  * @brief Verifica se todos os elementos de um intervalo satisfazem um predicado.
  *
  * Esta função verifica se todos os elementos no intervalo definido pelos iteradores @p first
  * e @p last satisfazem o predicado especificado pela função @p p.
+ * Se @p p for uma expressão com `graal::_1` e o range for contíguo de `int32_t`, `int64_t`,
+ * `float` ou `double`, os elementos são testados em blocos SIMD.
  *
  * @tparam InputIt O tipo do iterador de entrada usado para acessar os elementos do intervalo.
  * @tparam UnaryPredicate O tipo do predicado unário que determina se um elemento satisfaz a condição.
@@ -131,6 +4209,11 @@ InputIt find_if(InputIt first, InputIt last, UnaryPredicate p) {
 
 template <class InputIt, class UnaryPredicate>
 bool all_of(InputIt first, InputIt last, UnaryPredicate p) {
+  if constexpr (detail::expr_simd_enabled<InputIt, UnaryPredicate>::value) {
+    // Procura o primeiro elemento que falha no predicado.
+    const auto n = static_cast<std::size_t>(last - first);
+    return n == 0 || detail::expr_find<true>(detail::to_pointer(first), n, p) == n;
+  }
   while(first != last){
     if(!p(*first)){
       return false;
@@ -145,6 +4228,8 @@ bool all_of(InputIt first, InputIt last, UnaryPredicate p) {
  *
  * Esta função verifica se pelo menos um dos elementos no intervalo definido pelos iteradores @p first
  * e @p last satisfaz o predicado especificado pela função @p p.
+ * Se @p p for uma expressão com `graal::_1` e o range for contíguo de `int32_t`, `int64_t`,
+ * `float` ou `double`, os elementos são testados em blocos SIMD.
  *
  * @tparam InputIt O tipo do iterador de entrada usado para acessar os elementos do intervalo.
  * @tparam UnaryPredicate O tipo do predicado unário que determina se um elemento satisfaz a condição.
@@ -156,6 +4241,10 @@ bool all_of(InputIt first, InputIt last, UnaryPredicate p) {
 
 template <class InputIt, class UnaryPredicate>
 bool any_of(InputIt first, InputIt last, UnaryPredicate p) {
+  if constexpr (detail::expr_simd_enabled<InputIt, UnaryPredicate>::value) {
+    const auto n = static_cast<std::size_t>(last - first);
+    return n != 0 && detail::expr_find<false>(detail::to_pointer(first), n, p) != n;
+  }
   while(first != last){
     if(p(*first)){
       return true;
@@ -171,6 +4260,8 @@ bool any_of(InputIt first, InputIt last, UnaryPredicate p) {
  *
  * Esta função verifica se nenhum dos elementos no intervalo definido pelos iteradores @p first
  * e @p last satisfaz o predicado especificado pela função @p p.
+ * Se @p p for uma expressão com `graal::_1` e o range for contíguo de `int32_t`, `int64_t`,
+ * `float` ou `double`, os elementos são testados em blocos SIMD.
  *
  * @tparam InputIt O tipo do iterador de entrada usado para acessar os elementos do intervalo.
  * @tparam UnaryPredicate O tipo do predicado unário que determina se um elemento satisfaz a condição.
@@ -182,6 +4273,10 @@ bool any_of(InputIt first, InputIt last, UnaryPredicate p) {
 
 template <class InputIt, class UnaryPredicate>
 bool none_of(InputIt first, InputIt last, UnaryPredicate p) {
+  if constexpr (detail::expr_simd_enabled<InputIt, UnaryPredicate>::value) {
+    const auto n = static_cast<std::size_t>(last - first);
+    return n == 0 || detail::expr_find<false>(detail::to_pointer(first), n, p) == n;
+  }
   for(auto it = first; it != last; ++it){
     if(p(*it)){
       return false;
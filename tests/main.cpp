@@ -1,8 +1,15 @@
 #include <array>
 #include <cassert>   // assert()
+#include <cstring>
+#include <forward_list>
 #include <iostream>  // cout, endl
 #include <iterator>  // std::begin(), std::end()
+#include <limits>
+#include <numeric>
+#include <list>
 #include <random>    // random_device, mt19937
+#include <string>
+#include <vector>
 
 // The test manager header
 #include "include/tm/test_manager.h"
@@ -162,6 +169,444 @@ int main() {
     EXPECT_EQ(*max, 1);
   }
 
+  {
+    BEGIN_TEST(tm, "MinMax8", "VectorizedMatchesStdWithTies");
+    std::mt19937 gen{ 42 };
+    std::uniform_int_distribution<int> dist{ -20, 20 };
+    bool ok{ true };
+    // Tamanhos variados para cobrir blocos completos e caudas escalares.
+    for (int n = 1; n < 200; ++n) {
+      std::vector<int> V(n);
+      std::vector<long long> L(n);
+      std::vector<double> D(n);
+      for (int i = 0; i < n; ++i) {
+        V[i] = dist(gen);
+        L[i] = V[i];
+        D[i] = V[i] * 0.5;
+      }
+      auto r = graal::minmax(V.begin(), V.end(), std::less<>());
+      auto e = std::minmax_element(V.begin(), V.end());
+      ok = ok and r.first == e.first and r.second == e.second;
+      auto rl = graal::minmax(L.data(), L.data() + n, std::less<long long>());
+      auto el = std::minmax_element(L.data(), L.data() + n);
+      ok = ok and rl.first == el.first and rl.second == el.second;
+      auto rd = graal::minmax(D.cbegin(), D.cend(), std::greater<>());
+      auto ed = std::minmax_element(D.cbegin(), D.cend(), std::greater<>());
+      ok = ok and rd.first == ed.first and rd.second == ed.second;
+    }
+    EXPECT_TRUE(ok);
+  }
+
+  {
+    BEGIN_TEST(tm, "MinMax9", "VectorizedFloatAllEqual");
+    std::vector<float> V(37, 2.5f);
+    auto result = graal::minmax(V.begin(), V.end(), std::less<>());
+    EXPECT_EQ(result.first, V.begin());
+    EXPECT_EQ(result.second, std::prev(V.end()));
+  }
+
+  {
+    BEGIN_TEST(tm, "MinMax10", "ForwardIteratorAndComparisonCount");
+    std::forward_list<std::string> L{ "pear", "fig", "kiwi", "apple", "fig", "pear", "apple" };
+    size_t calls{ 0 };
+    auto cmp = [&calls](const std::string& a, const std::string& b) {
+      ++calls;
+      return a < b;
+    };
+    auto result = graal::minmax(L.begin(), L.end(), cmp);
+    auto eresult = std::minmax_element(L.begin(), L.end());
+    EXPECT_EQ(result.first, eresult.first);
+    EXPECT_EQ(result.second, eresult.second);
+    // No máximo 3 comparações por par de elementos: 7 elementos -> 3 pares + 1 sobra.
+    EXPECT_LE(calls, 3u * 3u + 2u);
+  }
+
+  {
+    BEGIN_TEST(tm, "MinMax11", "ParallelMatchesSequential");
+    std::mt19937 gen{ 7 };
+    std::uniform_int_distribution<int> dist{ 0, 50 };
+    std::vector<int> V(100'003);
+    std::vector<std::string> S(5'001);
+    for (auto& e : V) {
+      e = dist(gen);
+    }
+    for (auto& e : S) {
+      e = std::to_string(dist(gen));
+    }
+    graal::execution::parallel_policy policy{ 4, 64 };
+    auto result = graal::minmax(policy, V.begin(), V.end(), std::less<>());
+    auto eresult = graal::minmax(V.begin(), V.end(), std::less<>());
+    EXPECT_EQ(result.first, eresult.first);
+    EXPECT_EQ(result.second, eresult.second);
+    auto sresult = graal::minmax(policy, S.begin(), S.end(), std::greater<>());
+    auto esresult = std::minmax_element(S.begin(), S.end(), std::greater<>());
+    EXPECT_EQ(sresult.first, esresult.first);
+    EXPECT_EQ(sresult.second, esresult.second);
+    auto empty = graal::minmax(graal::execution::par, V.begin(), V.begin(), std::less<>());
+    EXPECT_EQ(empty.first, V.begin());
+  }
+
+  {
+    BEGIN_TEST(tm, "MinMax12", "NanPolicies");
+    const double nan = std::numeric_limits<double>::quiet_NaN();
+    const double inf = std::numeric_limits<double>::infinity();
+    std::mt19937 gen{ 13 };
+    std::uniform_int_distribution<int> dist{ 0, 12 };
+    bool ok{ true };
+    for (int n = 1; n < 120; ++n) {
+      // Cerca de 1 em 13 elementos é NaN; os demais têm muitos empates e infinitos.
+      std::vector<double> D(n);
+      for (auto& e : D) {
+        int r = dist(gen);
+        e = r == 0 ? nan : (r == 12 ? inf : r % 5);
+      }
+      std::list<double> L(D.begin(), D.end());
+      std::vector<double> clean;
+      std::copy_if(D.begin(), D.end(), std::back_inserter(clean), [](double d) { return d == d; });
+      auto first_nan = std::find_if(D.begin(), D.end(), [](double d) { return d != d; });
+      auto last_nan = std::find_if(D.rbegin(), D.rend(), [](double d) { return d != d; });
+
+      auto ig = graal::minmax(D.begin(), D.end(), graal::nan_policy::ignore);
+      auto lig = graal::minmax(L.begin(), L.end(), graal::nan_policy::ignore);
+      if (clean.empty()) {
+        ok = ok and ig.first == D.end() and ig.second == D.end();
+      } else {
+        auto e = std::minmax_element(clean.begin(), clean.end());
+        ok = ok and *ig.first == *e.first and *ig.second == *e.second;
+        // Ordinal do elemento escolhido entre os não-NaN.
+        auto rank = [&D](std::vector<double>::iterator it) {
+          return std::count_if(D.begin(), it, [](double d) { return d == d; });
+        };
+        ok = ok and rank(ig.first) == e.first - clean.begin();
+        ok = ok and rank(ig.second) == e.second - clean.begin();
+      }
+      ok = ok and std::distance(L.begin(), lig.first) == ig.first - D.begin();
+      ok = ok and std::distance(L.begin(), lig.second) == ig.second - D.begin();
+
+      auto pr = graal::minmax(D.begin(), D.end(), graal::nan_policy::propagate);
+      if (first_nan != D.end()) {
+        ok = ok and pr.first == first_nan and pr.second == first_nan;
+      } else {
+        ok = ok and pr == ig;
+      }
+
+      auto lg = graal::minmax(D.begin(), D.end(), graal::nan_policy::largest);
+      if (first_nan != D.end()) {
+        ok = ok and lg.second == std::prev(last_nan.base());
+        ok = ok and lg.first == (clean.empty() ? D.begin() : ig.first);
+      } else {
+        ok = ok and lg == ig;
+      }
+    }
+    EXPECT_TRUE(ok);
+
+    std::vector<float> F(40, 1.0f);
+    F[3] = F[30] = std::numeric_limits<float>::quiet_NaN();
+    F[20] = -2.0f;
+    auto fr = graal::minmax(F.begin(), F.end(), graal::nan_policy::largest);
+    EXPECT_EQ(fr.first, F.begin() + 20);
+    EXPECT_EQ(fr.second, F.begin() + 30);
+    fr = graal::minmax(F.begin(), F.end(), graal::nan_policy::propagate);
+    EXPECT_EQ(fr.first, F.begin() + 3);
+    fr = graal::minmax(F.begin(), F.end(), graal::nan_policy::ignore);
+    EXPECT_EQ(fr.second, F.end() - 1);
+
+#if GRAAL_SIMD_LEVEL > 0
+    // Fora do modo que para no primeiro NaN, o estado parcial (combinado entre blocos)
+    // também precisa da posição correta do primeiro NaN.
+    auto st = graal::detail::minmax_nan_simd<false>(F.data(), F.size());
+    EXPECT_TRUE(st.has_nan);
+    EXPECT_EQ(st.first_nan, 3u);
+    EXPECT_EQ(st.last_nan, 30u);
+#endif
+  }
+
+  //== sliding_minmax
+
+  {
+    BEGIN_TEST(tm, "SlidingMinMax", "MatchesMinMaxOnEveryWindow");
+    std::mt19937 gen{ 3 };
+    std::uniform_int_distribution<int> dist{ 0, 9 };
+    std::vector<int> V(500);
+    for (auto& e : V) {
+      e = dist(gen);
+    }
+    bool ok{ true };
+    for (size_t w : { 1u, 2u, 5u, 17u, 500u }) {
+      std::vector<std::pair<std::vector<int>::iterator, std::vector<int>::iterator>> out;
+      graal::sliding_minmax(V.begin(), V.end(), w, std::back_inserter(out), std::less<>());
+      ok = ok and out.size() == V.size() - w + 1;
+      for (size_t k = 0; k < out.size(); ++k) {
+        auto e = graal::minmax(V.begin() + k, V.begin() + k + w, std::less<>());
+        ok = ok and out[k] == e;
+      }
+    }
+    EXPECT_TRUE(ok);
+  }
+
+  {
+    BEGIN_TEST(tm, "SlidingMinMax2", "StreamingSink");
+    graal::sliding_window_minmax<int> w{ 3 };
+    std::array A{ 4, 1, 7, 1, 3, 9, 2 };
+    std::copy(std::begin(A), std::end(A), w.sink());
+    // Janela final: { 3, 9, 2 }.
+    EXPECT_TRUE(w.full());
+    EXPECT_EQ(w.min(), 2);
+    EXPECT_EQ(w.max(), 9);
+    EXPECT_EQ(w.max_index(), 5u);
+    w.clear();
+    w.push(5);
+    EXPECT_EQ(w.size(), 1u);
+    EXPECT_EQ(w.min(), 5);
+  }
+
+  {
+    BEGIN_TEST(tm, "SlidingMinMax3", "NonDefaultConstructibleElements");
+    struct ND {
+      explicit ND(int v) : value{ v }, label{ std::to_string(v) } {}
+      int value;
+      std::string label;
+    };
+    auto by_value = [](const ND& a, const ND& b) { return a.value < b.value; };
+    graal::sliding_window_minmax<ND, decltype(by_value)> w{ 3, by_value };
+    for (int v : { 4, 1, 7, 1, 3, 9, 2 }) {
+      w.push(ND{ v });
+    }
+    auto copy = w;
+    w.clear();
+    EXPECT_TRUE(w.empty());
+    EXPECT_EQ(copy.min().label, "2");
+    EXPECT_EQ(copy.max().label, "9");
+    copy.push(ND{ 8 });
+    EXPECT_EQ(copy.max_index(), 5u);
+    EXPECT_EQ(copy.min().value, 2);
+  }
+
+  //== range_minmax
+
+  {
+    BEGIN_TEST(tm, "RangeMinMax", "MatchesMinMaxOnRandomQueries");
+    std::mt19937 gen{ 11 };
+    std::uniform_int_distribution<int> dist{ 0, 30 };
+    std::vector<int> V(1000);
+    for (auto& e : V) {
+      e = dist(gen);
+    }
+    graal::range_minmax<std::vector<int>::const_iterator> index{ V.cbegin(), V.cend() };
+    graal::range_minmax<std::vector<int>::const_iterator, std::greater<>> rindex{ V.cbegin(),
+                                                                                   V.cend() };
+    std::uniform_int_distribution<size_t> pos{ 0, V.size() };
+    bool ok{ true };
+    for (int q = 0; q < 2000; ++q) {
+      size_t i = pos(gen), j = pos(gen);
+      if (i > j) {
+        std::swap(i, j);
+      }
+      ok = ok
+           and index.minmax(i, j) == graal::minmax(V.cbegin() + i, V.cbegin() + j, std::less<>());
+      ok = ok
+           and rindex.minmax(i, j)
+                 == graal::minmax(V.cbegin() + i, V.cbegin() + j, std::greater<>());
+    }
+    ok = ok and index.minmax(0, V.size()) == graal::minmax(V.cbegin(), V.cend(), std::less<>());
+    EXPECT_TRUE(ok);
+    EXPECT_EQ(index.size(), V.size());
+  }
+
+  //== minmax_multi
+
+  {
+    BEGIN_TEST(tm, "MinMaxMulti", "MemberPointersMatchMinMax");
+    struct Row {
+      long long timestamp;
+      double latency;
+      int size;
+    };
+    std::mt19937 gen{ 5 };
+    std::uniform_int_distribution<int> dist{ 0, 40 };
+    std::vector<Row> R(1000);
+    for (auto& r : R) {
+      r = Row{ dist(gen), dist(gen) * 0.25, dist(gen) };
+    }
+    auto [ts, lat, sz]
+      = graal::minmax_multi(R.begin(), R.end(), &Row::timestamp, &Row::latency, &Row::size);
+    auto by = [](auto field) {
+      return [field](const Row& a, const Row& b) { return a.*field < b.*field; };
+    };
+    EXPECT_TRUE(ts == graal::minmax(R.begin(), R.end(), by(&Row::timestamp)));
+    EXPECT_TRUE(lat == graal::minmax(R.begin(), R.end(), by(&Row::latency)));
+    EXPECT_TRUE(sz == graal::minmax(R.begin(), R.end(), by(&Row::size)));
+  }
+
+  {
+    BEGIN_TEST(tm, "MinMaxMulti3", "ConstMemberPointers");
+    struct Row {
+      const int a;
+      float b;
+    };
+    std::mt19937 gen{ 6 };
+    std::uniform_int_distribution<int> dist{ -50, 50 };
+    std::vector<Row> R;
+    for (int i = 0; i < 700; ++i) {
+      R.push_back(Row{ dist(gen), dist(gen) * 0.5f });
+    }
+    auto [a, b] = graal::minmax_multi(R.begin(), R.end(), &Row::a, &Row::b);
+    EXPECT_TRUE(a == graal::minmax(R.begin(), R.end(), [](const Row& x, const Row& y) {
+                  return x.a < y.a;
+                }));
+    EXPECT_TRUE(b == graal::minmax(R.begin(), R.end(), [](const Row& x, const Row& y) {
+                  return x.b < y.b;
+                }));
+  }
+
+  {
+    BEGIN_TEST(tm, "MinMaxMulti2", "CallableProjectionsForwardList");
+    std::forward_list<std::string> L{ "ccc", "a", "bb", "a", "dddd", "e" };
+    auto length = [](const std::string& s) { return s.size(); };
+    auto self = [](const std::string& s) -> const std::string& { return s; };
+    auto [lex, len] = graal::minmax_multi(L.begin(), L.end(), self, length);
+    auto elex = std::minmax_element(L.begin(), L.end());
+    EXPECT_TRUE(lex == elex);
+    EXPECT_EQ(*len.first, "a");
+    EXPECT_EQ(*len.second, "dddd");
+  }
+
+  //== quantile_sketch
+
+  {
+    BEGIN_TEST(tm, "QuantileSketch", "MergedShardsApproximateQuantiles");
+    const int n = 200'000;
+    std::vector<int> V(n);
+    std::iota(V.begin(), V.end(), 0);
+    std::shuffle(V.begin(), V.end(), std::mt19937{ 17 });
+    // Quatro "threads", cada uma com seu sketch, combinadas no final.
+    std::vector<graal::quantile_sketch<int>> shards(4);
+    for (int i = 0; i < n; ++i) {
+      shards[i % 4].push(V[i]);
+    }
+    for (size_t s = 1; s < shards.size(); ++s) {
+      shards[0].merge(shards[s]);
+    }
+    const auto& sketch = shards[0];
+    EXPECT_EQ(sketch.size(), static_cast<uint64_t>(n));
+    EXPECT_EQ(sketch.quantile(0.0), 0);
+    EXPECT_EQ(sketch.quantile(1.0), n - 1);
+    // Erro de posto de até 2% do total.
+    for (double q : { 0.5, 0.9, 0.99, 0.999 }) {
+      EXPECT_LE(std::abs(sketch.quantile(q) - q * n), 0.02 * n);
+    }
+    EXPECT_LT(sketch.retained(), 2000u);
+  }
+
+  {
+    BEGIN_TEST(tm, "QuantileSketch2", "SmallRangeIsExact");
+    std::array A{ 5.0, 1.0, 4.0, 2.0, 3.0 };
+    graal::quantile_sketch<double> sketch{ std::begin(A), std::end(A) };
+    EXPECT_EQ(sketch.quantile(0.5), 3.0);
+    EXPECT_EQ(sketch.min(), 1.0);
+    EXPECT_EQ(sketch.max(), 5.0);
+  }
+
+  //== top_k / bottom_k
+
+  {
+    BEGIN_TEST(tm, "TopK", "MatchesStableSort");
+    std::mt19937 gen{ 23 };
+    std::uniform_int_distribution<int> dist{ -500, 500 };
+    std::vector<int> V(10'000);
+    for (auto& e : V) {
+      e = dist(gen);
+    }
+    std::vector<int> sorted{ V };
+    std::sort(sorted.begin(), sorted.end());
+    bool ok{ true };
+    for (size_t k : { 0u, 1u, 10u, 257u }) {
+      std::vector<int> top, bottom, rtop;
+      graal::top_k(V.begin(), V.end(), k, std::less<>(), std::back_inserter(top));
+      graal::bottom_k(V.begin(), V.end(), k, std::less<>(), std::back_inserter(bottom));
+      graal::top_k(V.begin(), V.end(), k, std::greater<>(), std::back_inserter(rtop));
+      ok = ok and top.size() == k and bottom.size() == k;
+      ok = ok and std::equal(top.begin(), top.end(), sorted.rbegin());
+      ok = ok and std::equal(bottom.begin(), bottom.end(), sorted.begin());
+      ok = ok and rtop == bottom;
+    }
+    // Range vazio: nada é escrito, e o caminho vetorial não desreferencia `first`.
+    std::vector<int> empty, none;
+    graal::top_k(empty.begin(), empty.end(), 3, std::less<>(), std::back_inserter(none));
+    graal::bottom_k(empty.begin(), empty.end(), 3, std::less<>(), std::back_inserter(none));
+    ok = ok and none.empty();
+    EXPECT_TRUE(ok);
+  }
+
+  {
+    BEGIN_TEST(tm, "TopK2", "StableTiesAndShortRange");
+    using Req = std::pair<int, char>;  // (latência, id)
+    std::list<Req> L{ { 5, 'a' }, { 9, 'b' }, { 5, 'c' }, { 9, 'd' }, { 1, 'e' } };
+    auto by_latency = [](const Req& a, const Req& b) { return a.first < b.first; };
+    std::vector<Req> top;
+    graal::top_k(L.begin(), L.end(), 3, by_latency, std::back_inserter(top));
+    std::vector<Req> expected{ { 9, 'b' }, { 9, 'd' }, { 5, 'a' } };
+    EXPECT_TRUE(top == expected);
+    std::vector<Req> all;
+    graal::bottom_k(L.begin(), L.end(), 10, by_latency, std::back_inserter(all));
+    EXPECT_EQ(all.size(), 5u);
+    EXPECT_EQ(all.front().second, 'e');
+
+    // `k` muito maior que o range: nada é reservado além do próprio range.
+    std::vector<int> V{ 4, 1, 3 };
+    std::vector<int> huge;
+    graal::top_k(V.begin(), V.end(), std::numeric_limits<std::size_t>::max(), std::less<>(),
+                 std::back_inserter(huge));
+    EXPECT_TRUE((huge == std::vector{ 4, 3, 1 }));
+    std::vector<int> huge2;
+    graal::bottom_k(V.begin(), V.end(), std::size_t{ 1 } << 40, std::less<>(),
+                    std::back_inserter(huge2));
+    EXPECT_TRUE((huge2 == std::vector{ 1, 3, 4 }));
+  }
+
+  //== segmented_minmax
+
+  {
+    BEGIN_TEST(tm, "SegmentedMinMax", "MatchesMinMaxPerSegment");
+    std::mt19937 gen{ 29 };
+    std::uniform_int_distribution<int> dist{ 0, 15 };
+    std::uniform_int_distribution<int> len{ 0, 50 };
+    std::vector<int> offsets{ 0 };
+    while (offsets.back() < 20'000) {
+      offsets.push_back(offsets.back() + len(gen));
+    }
+    std::vector<int> V(offsets.back());
+    for (auto& e : V) {
+      e = dist(gen);
+    }
+    std::vector<double> D(V.begin(), V.end());
+    using result_t = std::pair<size_t, size_t>;
+    const size_t segments = offsets.size() - 1;
+    std::vector<result_t> out(segments), dout(segments), pout(segments);
+    auto end = graal::segmented_minmax(
+      V.begin(), V.end(), offsets.begin(), offsets.end(), out.begin(), std::less<>());
+    graal::segmented_minmax(
+      D.begin(), D.end(), offsets.begin(), offsets.end(), dout.begin(), std::greater<>());
+    graal::segmented_minmax(graal::execution::parallel_policy{ 3, 16 },
+                            V.begin(),
+                            V.end(),
+                            offsets.begin(),
+                            offsets.end(),
+                            pout.begin(),
+                            [](int a, int b) { return a < b; });
+    EXPECT_EQ(end, out.end());
+    bool ok{ true };
+    for (size_t s = 0; s < segments; ++s) {
+      auto b = V.begin() + offsets[s], e = V.begin() + offsets[s + 1];
+      auto r = graal::minmax(b, e, std::less<>());
+      result_t expected{ r.first - V.begin(), r.second - V.begin() };
+      ok = ok and out[s] == expected and pout[s] == expected;
+      auto rd = graal::minmax(D.begin() + offsets[s], D.begin() + offsets[s + 1], std::greater<>());
+      ok = ok and dout[s] == result_t(rd.first - D.begin(), rd.second - D.begin());
+    }
+    EXPECT_TRUE(ok);
+  }
+
   //== Reverse
 
   {
@@ -201,6 +646,184 @@ int main() {
     EXPECT_TRUE(std::equal(std::begin(A), std::end(A), std::begin(A_E)));
   }
 
+  {
+    BEGIN_TEST(tm, "Reverse5", "VectorizedMatchesStdAllElementSizes");
+    bool ok{ true };
+    auto check = [&ok](auto sample) {
+      using T = decltype(sample);
+      for (int n = 0; n < 300; n += (n < 40 ? 1 : 37)) {
+        std::vector<T> V(n), E(n);
+        for (int i = 0; i < n; ++i) {
+          V[i] = E[i] = static_cast<T>(i * 7 + 1);
+        }
+        which_lib::reverse(V.begin(), V.end());
+        std::reverse(E.begin(), E.end());
+        ok = ok and V == E;
+      }
+    };
+    check(char{});
+    check(short{});
+    check(float{});
+    check(double{});
+    EXPECT_TRUE(ok);
+  }
+
+  {
+    BEGIN_TEST(tm, "Reverse6", "BidirectionalIterators");
+    std::list<std::string> L{ "a", "b", "c", "d", "e" };
+    which_lib::reverse(L.begin(), L.end());
+    EXPECT_TRUE((L == std::list<std::string>{ "e", "d", "c", "b", "a" }));
+    which_lib::reverse(std::next(L.begin()), std::prev(L.end()));
+    EXPECT_TRUE((L == std::list<std::string>{ "e", "b", "c", "d", "a" }));
+  }
+
+  {
+    BEGIN_TEST(tm, "Reverse7", "NodeRelinkingKeepsAddresses");
+    using Record = std::array<char, 4096>;
+    std::list<Record> L(6);
+    std::vector<const Record*> before;
+    char tag{ 'a' };
+    for (auto& r : L) {
+      r[0] = tag++;
+      before.push_back(&r);
+    }
+    // Sub-range [1, 5): os nós mudam de posição, mas não de endereço.
+    graal::reverse(L, std::next(L.begin()), std::prev(L.end()));
+    std::string order;
+    std::vector<const Record*> after;
+    for (auto& r : L) {
+      order += r[0];
+      after.push_back(&r);
+    }
+    EXPECT_EQ(order, "aedcbf");
+    EXPECT_EQ(after[1], before[4]);
+    EXPECT_EQ(after[4], before[1]);
+    graal::reverse(L);
+    EXPECT_EQ(L.front()[0], 'f');
+    std::forward_list<int> F{ 1, 2, 3 };
+    graal::reverse(F);
+    EXPECT_EQ(F.front(), 3);
+  }
+
+  {
+    BEGIN_TEST(tm, "Reverse8", "ParallelMatchesSequential");
+    graal::execution::parallel_policy policy{ 4, 100 };
+    bool ok{ true };
+    for (size_t n : { 0u, 1u, 7u, 1001u, 40'000u }) {
+      std::vector<int> V(n), E(n);
+      std::vector<std::string> S(n), SE(n);
+      for (size_t i = 0; i < n; ++i) {
+        V[i] = E[i] = static_cast<int>(i);
+        S[i] = SE[i] = std::to_string(i);
+      }
+      // Começa desalinhado para exercitar o prefixo até a linha de cache.
+      if (n > 1) {
+        graal::reverse(policy, V.begin() + 1, V.end());
+        std::reverse(E.begin() + 1, E.end());
+      }
+      graal::reverse(policy, S.begin(), S.end());
+      std::reverse(SE.begin(), SE.end());
+      ok = ok and V == E and S == SE;
+    }
+    EXPECT_TRUE(ok);
+  }
+
+  //== rotate / rotate_copy
+
+  {
+    BEGIN_TEST(tm, "Rotate", "AllStrategiesMatchStd");
+    bool ok{ true };
+    auto check = [&ok](auto sample, size_t n) {
+      using C = decltype(sample);
+      for (size_t k = 0; k <= n; ++k) {
+        C A(n), E(n);
+        size_t i = 0;
+        for (auto a = A.begin(), e = E.begin(); a != A.end(); ++a, ++e, ++i) {
+          *a = *e = typename C::value_type{ static_cast<int>(i) };
+        }
+        auto result = graal::rotate(A.begin(), std::next(A.begin(), k), A.end());
+        auto eresult = std::rotate(E.begin(), std::next(E.begin(), k), E.end());
+        ok = ok and A == E
+             and std::distance(A.begin(), result) == std::distance(E.begin(), eresult);
+      }
+    };
+    check(std::vector<int>{}, 300);          // buffer em pilha e três inversões vetoriais
+    check(std::vector<std::array<int, 25>>{}, 40);  // elementos grandes: ciclos
+    check(std::vector<std::vector<int>>{}, 30);     // não trivialmente copiável: ciclos
+    check(std::list<int>{}, 30);                    // bidirecional
+    check(std::forward_list<int>{}, 30);            // de avanço
+    // Iterador proxy: o temporário dos ciclos precisa guardar o valor, não uma referência.
+    for (size_t k = 0; k <= 12; ++k) {
+      std::vector<bool> A(12), E(12);
+      for (size_t i = 0; i < 12; ++i) {
+        A[i] = E[i] = (i % 3 == 0) || i == 7;
+      }
+      graal::rotate(A.begin(), A.begin() + k, A.end());
+      std::rotate(E.begin(), E.begin() + k, E.end());
+      ok = ok and A == E;
+    }
+    EXPECT_TRUE(ok);
+  }
+
+  {
+    BEGIN_TEST(tm, "RotateCopy", "ContiguousAndList");
+    std::array A{ 1, 2, 3, 4, 5, 6 };
+    std::array<int, 6> B{};
+    auto end = graal::rotate_copy(std::begin(A), std::begin(A) + 2, std::end(A), std::begin(B));
+    EXPECT_EQ(end, std::end(B));
+    EXPECT_TRUE((B == std::array{ 3, 4, 5, 6, 1, 2 }));
+    std::list<int> L(std::begin(A), std::end(A));
+    std::vector<int> V;
+    graal::rotate_copy(L.begin(), std::next(L.begin(), 5), L.end(), std::back_inserter(V));
+    EXPECT_TRUE((V == std::vector{ 6, 1, 2, 3, 4, 5 }));
+  }
+
+  //== byteswap_range / byteswap_copy
+
+  {
+    BEGIN_TEST(tm, "Byteswap", "MatchesScalarReference");
+    bool ok{ true };
+    auto check = [&ok](auto sample) {
+      using T = decltype(sample);
+      for (size_t n : { 0, 1, 7, 33, 130 }) {
+        std::vector<T> A(n), E(n);
+        for (size_t i = 0; i < n; ++i) {
+          auto v = static_cast<T>(0x0123456789ABCDEFull * (i + 1));
+          A[i] = v;
+          unsigned char b[sizeof(T)];
+          std::memcpy(b, &v, sizeof(T));
+          std::reverse(b, b + sizeof(T));
+          std::memcpy(&E[i], b, sizeof(T));
+        }
+        std::vector<T> B(n);
+        auto end = graal::byteswap_copy(A.begin(), A.end(), B.begin());
+        ok = ok and end == B.end() and B == E;
+        graal::byteswap_range(A.begin(), A.end());
+        ok = ok and A == E;
+      }
+    };
+    check(std::uint16_t{});
+    check(std::uint32_t{});
+    check(std::uint64_t{});
+    check(std::int32_t{});
+    check(std::uint8_t{});
+    EXPECT_TRUE(ok);
+  }
+
+  {
+    BEGIN_TEST(tm, "Byteswap2", "RoundTripAndNonContiguous");
+    std::vector<double> A{ 1.5, -2.25, 1e300, 0.0, 3.0 };
+    auto B = A;
+    graal::byteswap_range(B.begin(), B.end());
+    EXPECT_FALSE(A == B);
+    graal::byteswap_range(B.begin(), B.end());
+    EXPECT_TRUE(A == B);
+    std::list<std::uint32_t> L{ 0x11223344u, 0xAABBCCDDu };
+    std::vector<std::uint32_t> V;
+    graal::byteswap_copy(L.begin(), L.end(), std::back_inserter(V));
+    EXPECT_TRUE((V == std::vector<std::uint32_t>{ 0x44332211u, 0xDDCCBBAAu }));
+  }
+
   //== Copy
 
   {
@@ -239,6 +862,437 @@ int main() {
     EXPECT_TRUE(std::equal(std::begin(A), std::end(A), std::begin(A_E)));
   }
 
+  {
+    BEGIN_TEST(tm, "Copy5", "HeterogeneousIterators");
+    std::vector<int> V{ 1, 2, 3, 4, 5 };
+    std::array<int, 5> A{};
+    auto a_end = which_lib::copy(V.begin(), V.end(), std::begin(A));
+    EXPECT_EQ(a_end, std::end(A));
+    EXPECT_TRUE(std::equal(V.begin(), V.end(), std::begin(A)));
+
+    int raw[5]{};
+    const int* src = A.data();
+    int* r_end = which_lib::copy(src, src + 5, raw);
+    EXPECT_EQ(r_end, raw + 5);
+    EXPECT_TRUE(std::equal(V.begin(), V.end(), raw));
+
+    std::list<int> L;
+    which_lib::copy(std::begin(raw), std::end(raw), std::back_inserter(L));
+    EXPECT_TRUE(std::equal(V.begin(), V.end(), L.begin(), L.end()));
+  }
+
+  {
+    BEGIN_TEST(tm, "Copy6", "ConvertingAndNonTrivial");
+    std::vector<int> V{ 1, -2, 3 };
+    std::vector<long long> W(3);
+    which_lib::copy(V.begin(), V.end(), W.begin());
+    EXPECT_TRUE((W == std::vector<long long>{ 1, -2, 3 }));
+
+    std::vector<std::string> S{ "a", "bb", "ccc" };
+    std::vector<std::string> T(3);
+    auto end = which_lib::copy(S.cbegin(), S.cend(), T.begin());
+    EXPECT_EQ(end, T.end());
+    EXPECT_TRUE(S == T);
+  }
+
+  {
+    BEGIN_TEST(tm, "Copy7", "StreamingMatchesCopy");
+    std::vector<int> V(100003);
+    std::iota(V.begin(), V.end(), -7);
+    bool ok{ true };
+    // Deslocamentos variados exercitam o alinhamento inicial e a sobra final.
+    for (size_t off : { 0, 1, 3, 5 }) {
+      std::vector<int> D(V.size() + 3, 0);
+      auto end = graal::copy(graal::streaming, V.begin() + off, V.end(), D.begin() + 3);
+      ok = ok and end == D.begin() + 3 + (V.size() - off)
+           and std::equal(V.begin() + off, V.end(), D.begin() + 3);
+    }
+    EXPECT_TRUE(ok);
+
+    // Sobreposição cai no memmove; tipos não contíguos no laço comum.
+    std::vector<int> O(V);
+    graal::copy(graal::streaming, O.begin() + 10, O.end(), O.begin());
+    EXPECT_TRUE(std::equal(V.begin() + 10, V.end(), O.begin()));
+    std::list<int> L;
+    graal::copy(graal::streaming, V.begin(), V.begin() + 4, std::back_inserter(L));
+    EXPECT_TRUE(std::equal(V.begin(), V.begin() + 4, L.begin(), L.end()));
+  }
+
+  {
+    BEGIN_TEST(tm, "Copy8", "ParallelMatchesSequential");
+    graal::execution::parallel_policy policy{ 4, 100 };
+    bool ok{ true };
+    for (size_t n : { 0u, 1u, 7u, 1001u, 40'000u }) {
+      std::vector<int> V(n);
+      std::vector<std::string> S(n);
+      for (size_t i = 0; i < n; ++i) {
+        V[i] = static_cast<int>(i) * 3;
+        S[i] = std::to_string(i);
+      }
+      // Destino deslocado para exercitar o prefixo até o início de página.
+      std::vector<int> D(n + 1, -1);
+      auto end = graal::copy(policy, V.begin(), V.end(), D.begin() + 1);
+      std::vector<std::string> SD(n);
+      graal::copy(policy, S.begin(), S.end(), SD.begin());
+      ok = ok and end == D.end() and D[0] == -1 and std::equal(V.begin(), V.end(), D.begin() + 1)
+           and S == SD;
+    }
+    EXPECT_TRUE(ok);
+
+    std::list<int> L{ 1, 2, 3 };
+    std::vector<int> W;
+    graal::copy(graal::execution::par, L.begin(), L.end(), std::back_inserter(W));
+    EXPECT_TRUE((W == std::vector{ 1, 2, 3 }));
+  }
+
+  //== copy_backward / move / move_backward / copy_overlapping
+
+  {
+    BEGIN_TEST(tm, "CopyBackward", "ShiftRightInPlace");
+    std::vector<int> V{ 1, 2, 3, 4, 5, 0, 0 };
+    auto first = graal::copy_backward(V.begin(), V.begin() + 5, V.end());
+    EXPECT_EQ(first, V.begin() + 2);
+    EXPECT_TRUE((V == std::vector{ 1, 2, 1, 2, 3, 4, 5 }));
+
+    std::list<int> L{ 1, 2, 3 };
+    std::vector<int> W(4, 0);
+    graal::copy_backward(L.begin(), L.end(), W.end());
+    EXPECT_TRUE((W == std::vector{ 0, 1, 2, 3 }));
+  }
+
+  {
+    BEGIN_TEST(tm, "Move", "TransfersInsteadOfCopying");
+    std::string big(100, 'x');
+    std::vector<std::string> S{ big, "b", "c" };
+    const char* buffer = S[0].data();
+    std::vector<std::string> D(3);
+    auto end = graal::move(S.begin(), S.end(), D.begin());
+    EXPECT_EQ(end, D.end());
+    EXPECT_EQ(D[0], big);
+    EXPECT_EQ(D[0].data(), buffer);  // O buffer foi transferido, não duplicado.
+
+    // Abre espaço no início, deslocando para a direita sem copiar as strings.
+    std::vector<std::string> I{ big, "b", "c", "" };
+    buffer = I[0].data();
+    auto first = graal::move_backward(I.begin(), I.begin() + 3, I.end());
+    EXPECT_EQ(first, I.begin() + 1);
+    EXPECT_EQ(I[1].data(), buffer);
+    EXPECT_EQ(I[3], "c");
+
+    std::vector<int> V{ 1, 2, 3, 4 };
+    graal::move_backward(V.begin(), V.begin() + 3, V.end());
+    EXPECT_TRUE((V == std::vector{ 1, 1, 2, 3 }));
+  }
+
+  {
+    BEGIN_TEST(tm, "CopyOverlapping", "BothDirections");
+    std::vector<std::string> S{ "a", "b", "c", "d", "e" };
+    graal::copy_overlapping(S.begin(), S.begin() + 3, S.begin() + 2);
+    EXPECT_TRUE((S == std::vector<std::string>{ "a", "b", "a", "b", "c" }));
+    graal::copy_overlapping(S.begin() + 2, S.end(), S.begin());
+    EXPECT_TRUE((S == std::vector<std::string>{ "a", "b", "c", "b", "c" }));
+
+    std::vector<int> V{ 1, 2, 3, 4, 5 };
+    auto end = graal::copy_overlapping(V.begin(), V.begin() + 4, V.begin() + 1);
+    EXPECT_EQ(end, V.end());
+    EXPECT_TRUE((V == std::vector{ 1, 1, 2, 3, 4 }));
+  }
+
+  //== gather_copy / scatter_copy
+
+  {
+    BEGIN_TEST(tm, "GatherScatter", "PermutationRoundTrip");
+    bool ok{ true };
+    auto check = [&ok](auto value, auto index) {
+      using T = decltype(value);
+      using I = decltype(index);
+      for (size_t n : { 0u, 3u, 17u, 1000u }) {
+        std::vector<T> src(n);
+        std::vector<I> perm(n);
+        for (size_t i = 0; i < n; ++i) {
+          src[i] = static_cast<T>(i * 7 + 1);
+          perm[i] = static_cast<I>(i);
+        }
+        std::shuffle(perm.begin(), perm.end(), std::mt19937{ 42 });
+        for (size_t dist : { 0u, 4u, 32u }) {
+          std::vector<T> out(n), back(n);
+          auto end = graal::gather_copy(perm.begin(), perm.end(), src.begin(), out.begin(), dist);
+          ok = ok and end == out.end();
+          for (size_t i = 0; i < n; ++i) {
+            ok = ok and out[i] == src[perm[i]];
+          }
+          auto idx_end = graal::scatter_copy(out.begin(), out.end(), perm.begin(), back.begin(), dist);
+          ok = ok and idx_end == perm.end() and back == src;
+        }
+      }
+    };
+    check(std::int32_t{}, std::int32_t{});    // gather/scatter de 32 bits
+    check(std::uint64_t{}, std::size_t{});    // gather/scatter de 64 bits
+    check(double{}, std::int64_t{});
+    check(std::int32_t{}, std::uint32_t{});   // sem sinal de 32 bits: laço escalar
+    check(std::int16_t{}, std::int32_t{});    // tamanhos diferentes: laço escalar
+    EXPECT_TRUE(ok);
+  }
+
+  {
+    BEGIN_TEST(tm, "GatherScatter2", "RepeatedIndicesAndNonContiguous");
+    std::vector<int> V(40);
+    std::iota(V.begin(), V.end(), 0);
+    std::vector<int> idx(40, 5);  // Todos gravam na posição 5: vence o último.
+    std::vector<int> D(10, -1);
+    graal::scatter_copy(V.begin(), V.end(), idx.begin(), D.begin());
+    EXPECT_EQ(D[5], 39);
+
+    std::list<int> L{ 3, 0, 2 };
+    std::vector<std::string> S{ "a", "b", "c", "d" };
+    std::vector<std::string> out;
+    graal::gather_copy(L.begin(), L.end(), S.begin(), std::back_inserter(out));
+    EXPECT_TRUE((out == std::vector<std::string>{ "d", "a", "c" }));
+  }
+
+  //== convert_copy
+
+  {
+    BEGIN_TEST(tm, "ConvertCopy", "WideningMatchesStaticCast");
+    bool ok{ true };
+    // Compara com o static_cast para comprimentos que cobrem os blocos e a sobra final.
+    auto check = [&ok](auto from, auto to) {
+      using F = decltype(from);
+      using T = decltype(to);
+      for (size_t n : { 0u, 1u, 15u, 16u, 37u }) {
+        std::vector<F> A(n);
+        for (size_t i = 0; i < n; ++i) {
+          if constexpr (std::is_floating_point<F>::value) {
+            A[i] = (static_cast<F>(i) - 18) * F(1234.567);
+          } else {
+            A[i] = static_cast<F>(std::numeric_limits<F>::max() / 37 * static_cast<F>(i)
+                                  - (std::is_signed<F>::value ? std::numeric_limits<F>::max() / 2 : 0));
+          }
+        }
+        std::vector<T> D(n);
+        auto end = graal::convert_copy<T>(A.begin(), A.end(), D.begin());
+        ok = ok and end == D.end();
+        for (size_t i = 0; i < n; ++i) {
+          ok = ok and D[i] == static_cast<T>(A[i]);
+        }
+      }
+    };
+    check(std::uint8_t{}, std::int32_t{});
+    check(std::int16_t{}, std::int32_t{});
+    check(std::uint16_t{}, std::int32_t{});
+    check(std::int32_t{}, std::int64_t{});
+    check(std::uint32_t{}, std::uint64_t{});
+    check(std::uint8_t{}, float{});
+    check(std::int16_t{}, float{});
+    check(std::int32_t{}, float{});
+    check(std::int32_t{}, double{});
+    check(float{}, double{});
+    check(double{}, float{});
+    check(long{}, double{});  // sem kernel: laço escalar
+    EXPECT_TRUE(ok);
+  }
+
+  {
+    BEGIN_TEST(tm, "ConvertCopy2", "NarrowingCastAndSaturate");
+    using I32 = std::numeric_limits<std::int32_t>;
+    const float nan = std::numeric_limits<float>::quiet_NaN();
+    const float inf = std::numeric_limits<float>::infinity();
+    std::vector<float> F{ 2.7f, -2.7f, 3e9f, -3e9f, nan, inf, -inf, 2147483520.0f, 0.0f };
+    F.insert(F.end(), F.begin(), F.end());  // 18 elementos: dois blocos e uma sobra.
+    std::vector<std::int32_t> I(F.size());
+    graal::convert_copy<std::int32_t>(F.begin(), F.end(), I.begin(), graal::convert_policy::saturate);
+    std::vector<std::int32_t> half{ 2, -2, I32::max(), I32::min(), 0, I32::max(), I32::min(), 2147483520, 0 };
+    EXPECT_TRUE(std::equal(half.begin(), half.end(), I.begin()));
+    EXPECT_TRUE(std::equal(half.begin(), half.end(), I.begin() + 9));
+
+    std::vector<std::uint64_t> U;
+    for (std::uint64_t v : { 0ull, 1ull, 0xFFFFFFFFull, 0x100000000ull, 0x1234567890ull, ~0ull }) {
+      U.push_back(v);
+      U.push_back(v);
+    }
+    std::vector<std::uint32_t> sat(U.size()), cut(U.size());
+    graal::convert_copy<std::uint32_t>(U.begin(), U.end(), sat.begin(), graal::convert_policy::saturate);
+    graal::convert_copy<std::uint32_t>(U.begin(), U.end(), cut.begin());
+    bool ok{ true };
+    for (size_t i = 0; i < U.size(); ++i) {
+      ok = ok and sat[i] == (U[i] > 0xFFFFFFFFull ? 0xFFFFFFFFu : static_cast<std::uint32_t>(U[i]))
+           and cut[i] == static_cast<std::uint32_t>(U[i]);
+    }
+    EXPECT_TRUE(ok);
+
+    std::vector<std::int32_t> W;
+    for (int i = 0; i < 37; ++i) {
+      W.push_back((i - 18) * 7919 * (i % 3 == 0 ? 100 : 1));
+    }
+    std::vector<std::int16_t> ws(W.size()), wc(W.size());
+    graal::convert_copy<std::int16_t>(W.begin(), W.end(), ws.begin(), graal::convert_policy::saturate);
+    graal::convert_copy<std::int16_t>(W.begin(), W.end(), wc.begin(), graal::convert_policy::cast);
+    for (size_t i = 0; i < W.size(); ++i) {
+      ok = ok and ws[i] == std::clamp<std::int32_t>(W[i], -32768, 32767)
+           and wc[i] == static_cast<std::int16_t>(W[i]);
+    }
+    EXPECT_TRUE(ok);
+
+    std::list<double> L{ -1.5, 300.0, 42.9 };
+    std::vector<std::uint8_t> B;
+    graal::convert_copy<std::uint8_t>(L.begin(), L.end(), std::back_inserter(B),
+                                      graal::convert_policy::saturate);
+    EXPECT_TRUE((B == std::vector<std::uint8_t>{ 0, 255, 42 }));
+  }
+
+  //== copy_if
+
+  {
+    BEGIN_TEST(tm, "CopyIf", "MatchesStdCopyIf");
+    bool ok{ true };
+    std::mt19937 gen{ 7 };
+    auto check = [&](auto sample) {
+      using T = decltype(sample);
+      for (size_t n : { 0u, 5u, 16u, 100u, 1001u }) {
+        std::vector<T> A(n);
+        for (auto& a : A) {
+          a = static_cast<T>(static_cast<int>(gen() % 1000) - 300);
+        }
+        auto pred = [](T x) { return x > T(400); };  // ~30% dos elementos
+        std::vector<T> E;
+        std::copy_if(A.begin(), A.end(), std::back_inserter(E), pred);
+        // Destino exato: o kernel não pode gravar além dos selecionados.
+        std::vector<T> D(E.size());
+        auto end = graal::copy_if(A.begin(), A.end(), D.begin(), pred);
+        ok = ok and end == D.end() and D == E;
+      }
+    };
+    check(std::int32_t{});
+    check(std::uint32_t{});
+    check(float{});
+    check(std::int64_t{});
+    check(double{});
+    check(std::int16_t{});  // sem kernel
+    EXPECT_TRUE(ok);
+  }
+
+  {
+    BEGIN_TEST(tm, "CopyIf2", "GenericIterators");
+    std::list<std::string> L{ "a", "bb", "ccc", "dd" };
+    std::vector<std::string> V;
+    graal::copy_if(L.begin(), L.end(), std::back_inserter(V),
+                   [](const std::string& x) { return x.size() == 2; });
+    EXPECT_TRUE((V == std::vector<std::string>{ "bb", "dd" }));
+
+    std::vector<int> A(50, 1);
+    std::vector<int> out;
+    graal::copy_if(A.begin(), A.end(), std::back_inserter(out), [](int x) { return x == 1; });
+    EXPECT_EQ(out.size(), 50u);
+  }
+
+  //== predicate expressions (graal::_1)
+
+  {
+    BEGIN_TEST(tm, "PredicateExpr", "ScalarCall");
+    using graal::_1;
+    auto in_range = _1 > 5 && _1 < 100;
+    EXPECT_TRUE(in_range(50));
+    EXPECT_FALSE(in_range(5));
+    EXPECT_FALSE(in_range(100));
+    EXPECT_TRUE((!(_1 == 3) || _1 >= 10)(4));
+    EXPECT_FALSE((!(_1 == 3) || _1 >= 10)(3));
+    EXPECT_TRUE((10 < _1)(11));   // Constante à esquerda: espelhado para _1 > 10.
+    EXPECT_TRUE((2.5 >= _1)(2.5));
+    EXPECT_TRUE((_1 != 1.0)(std::numeric_limits<double>::quiet_NaN()));
+  }
+
+  {
+    BEGIN_TEST(tm, "PredicateExpr2", "AlgorithmsMatchLambdas");
+    using graal::_1;
+    bool ok{ true };
+    std::mt19937 gen{ 11 };
+    auto check = [&](auto sample, auto expr, auto lambda) {
+      using T = decltype(sample);
+      for (size_t n : { 0u, 1u, 9u, 33u, 200u }) {
+        std::vector<T> A(n);
+        for (auto& a : A) {
+          a = static_cast<T>(static_cast<int>(gen() % 200) - 50);
+        }
+        if (n > 3) {
+          A[n - 2] = static_cast<T>(75);  // Garante ao menos um acerto perto do final.
+        }
+        ok = ok and graal::find_if(A.begin(), A.end(), expr) == std::find_if(A.begin(), A.end(), lambda)
+             and graal::all_of(A.begin(), A.end(), expr) == std::all_of(A.begin(), A.end(), lambda)
+             and graal::any_of(A.begin(), A.end(), expr) == std::any_of(A.begin(), A.end(), lambda)
+             and graal::none_of(A.begin(), A.end(), expr) == std::none_of(A.begin(), A.end(), lambda);
+        std::vector<T> E, D;
+        std::copy_if(A.begin(), A.end(), std::back_inserter(E), lambda);
+        D.resize(E.size());
+        ok = ok and graal::copy_if(A.begin(), A.end(), D.begin(), expr) == D.end() and D == E;
+        // Todos satisfazem / nenhum satisfaz.
+        std::vector<T> B(n, static_cast<T>(75));
+        ok = ok and graal::all_of(B.begin(), B.end(), expr) == std::all_of(B.begin(), B.end(), lambda)
+             and graal::none_of(B.begin(), B.end(), !expr) == std::all_of(B.begin(), B.end(), lambda);
+      }
+    };
+    check(int{}, _1 > 70 && _1 <= 100, [](auto x) { return x > 70 && x <= 100; });
+    check(long{}, _1 == 75 || _1 < -40, [](auto x) { return x == 75 || x < -40; });
+    check(float{}, !(_1 != 75.0f), [](auto x) { return x == 75.0f; });
+    check(double{}, 70 < _1, [](auto x) { return x > 70; });
+    check(int{}, _1 >= 74.5, [](auto x) { return x >= 74.5; });   // Comparação em double: escalar.
+    check(short{}, _1 > 70, [](auto x) { return x > 70; });       // Sem kernel: escalar.
+    EXPECT_TRUE(ok);
+
+    std::vector<double> N{ 1.0, std::numeric_limits<double>::quiet_NaN(), 2.0, 3.0, 4.0 };
+    EXPECT_EQ(graal::find_if(N.begin(), N.end(), _1 != 1.0), N.begin() + 1);
+    EXPECT_TRUE(graal::none_of(N.begin(), N.end(), _1 == 5.0 || _1 < 0.0));
+  }
+
+  //== find / find_not
+
+  {
+    BEGIN_TEST(tm, "Find", "MatchesStdFindAtEveryPosition");
+    bool ok{ true };
+    auto check = [&ok](auto sample) {
+      using T = decltype(sample);
+      const T needle = static_cast<T>(-3);
+      for (size_t off : { 0u, 1u, 3u }) {
+        for (size_t n : { 0u, 1u, 31u, 130u }) {
+          std::vector<T> A(n + off, static_cast<T>(7));
+          // Uma ocorrência em cada posição possível, partindo de endereços desalinhados.
+          for (size_t pos = off; pos <= A.size(); ++pos) {
+            if (pos < A.size()) {
+              A[pos] = needle;
+            }
+            ok = ok and graal::find(A.begin() + off, A.end(), needle) == std::find(A.begin() + off, A.end(), needle)
+                 and graal::find_not(A.begin() + off, A.end(), T(7))
+                       == std::find_if(A.begin() + off, A.end(), [](T x) { return x != T(7); });
+            if (pos < A.size()) {
+              A[pos] = static_cast<T>(7);
+            }
+          }
+        }
+      }
+    };
+    check(char{});
+    check(std::uint8_t{});
+    check(std::int16_t{});
+    check(std::uint32_t{});
+    check(std::int64_t{});
+    check(wchar_t{});
+    EXPECT_TRUE(ok);
+  }
+
+  {
+    BEGIN_TEST(tm, "Find2", "MixedValueTypes");
+    std::vector<std::uint8_t> B{ 44, 1, 2, 255 };
+    EXPECT_EQ(graal::find(B.begin(), B.end(), 300), B.end());  // 300 não cabe em uint8_t.
+    EXPECT_EQ(graal::find(B.begin(), B.end(), 255), B.begin() + 3);
+    EXPECT_EQ(graal::find_not(B.begin(), B.end(), -1), B.begin());
+    std::vector<std::uint32_t> U(40, 0);
+    U[33] = 0xFFFFFFFFu;
+    // Como no std::find, -1 é convertido para unsigned e encontra 0xFFFFFFFF.
+    EXPECT_EQ(graal::find(U.begin(), U.end(), -1), std::find(U.begin(), U.end(), -1));
+    std::list<std::string> L{ "a", "b", "c" };
+    EXPECT_EQ(graal::find(L.begin(), L.end(), "b"), std::next(L.begin()));
+    EXPECT_EQ(graal::find_not(L.begin(), L.end(), "a"), std::next(L.begin()));
+  }
+
   //== fund_if()
 
   {
@@ -289,6 +1343,30 @@ int main() {
     EXPECT_EQ(std::prev(std::end(A)), result);
   }
 
+  {
+    BEGIN_TEST(tm, "FindIf7", "ParallelReturnsFirstMatch");
+    graal::execution::parallel_policy policy{ 4, 100 };
+    std::vector<int> A(50'000, 0);
+    bool ok{ true };
+    // Acertos em várias posições; o segundo acerto fica em um bloco anterior ao de outras threads.
+    for (size_t pos : { 0u, 1u, 4095u, 4096u, 12'499u, 12'500u, 30'000u, 49'999u }) {
+      A[pos] = 1;
+      A[std::min<size_t>(pos + 20'000, A.size() - 1)] = 1;
+      auto expected = std::find(A.begin(), A.end(), 1);
+      ok = ok and graal::find_if(policy, A.begin(), A.end(), [](int x) { return x == 1; }) == expected
+           and graal::find_if(policy, A.begin(), A.end(), graal::_1 == 1) == expected;
+      std::fill(A.begin(), A.end(), 0);
+    }
+    ok = ok and graal::find_if(policy, A.begin(), A.end(), [](int x) { return x == 1; }) == A.end();
+    EXPECT_TRUE(ok);
+
+    std::list<int> L{ 3, 8, 9 };
+    EXPECT_EQ(graal::find_if(graal::execution::par, L.begin(), L.end(), [](int x) { return x > 5; }),
+              std::next(L.begin()));
+    EXPECT_EQ(graal::find_if(graal::execution::seq, A.begin(), A.end(), [](int x) { return x == 0; }),
+              A.begin());
+  }
+
   //== all_of
 
   {